@@ -104,6 +104,13 @@
  *              Therefore, adapt colors as needed for your build and LEDs in use.
  *              Note: LEDs dimming uses FastLED's nscale8_video() function. It provides a
  *              more color-preserving dimming effect than pure RGB value recalculation.
+ *              The dimmer knobs follow a perceptual curve (helpers/Gamma.h). For smoother
+ *              steps at the lowest brightness, enable BACKLIGHT_DITHERING below; this
+ *              outputs frames continuously while a dimmer sits between two of the lowest
+ *              32 levels. Each dither step waits for the previous frame, so with the full
+ *              pit (about 1300 LEDs, 40 ms per frame) the dither rate drops to about 25 Hz,
+ *              which can flicker visibly, and indicators wait for the frame in progress
+ *              (up to about 45 ms). Use it only on controllers with few LEDs per dimmer.
  *          (4) If you have an non-standard wiring / pinout of your backlight controller:
  *              Adapt the pinout in the "Define pinouts and channels" section in this file.
  *          (5) If you are using custom panels: 
@@ -123,6 +130,12 @@
  *              I observed that a faulty LED on a panel can cause the BLM to stop working 
  *              after a few mins of operation. The faulty LED is usually the first LED on 
  *              a channel that stays dark. Replacing the faulty LED should fix the issue.
+ *          (!) If the BLM stutters or reacts late:
+ *              Enable BACKLIGHT_PROFILER below. Holding the rotary encoder switch for 2 s
+ *              then sends the call counts and min/avg/max durations of each loop phase,
+ *              the free SRAM and the stack high-water mark as BL_PROFILE messages to the
+ *              DCS-BIOS connection, where they appear in its log. A short press changes
+ *              the mode on release in this build.
  * 
  *          **Technical Background**
  *          This sketch addresses the following functional OH requirements:
@@ -176,11 +189,13 @@
   #include <avr/power.h>
 #endif
 #define FASTLED_INTERRUPT_RETRY_COUNT 1                               // Define the number of retries for FastLED update
+#define FASTLED_ALLOW_INTERRUPTS 1                                    // Serve DCS-BIOS RX interrupts between LEDs
 #define DCSBIOS_DISABLE_SERVO                                         // Disable DCS-BIOS servo support (not used)
+//#define BACKLIGHT_DITHERING                                         // Dither the lowest dimmer levels (not for a full pit)
+//#define BACKLIGHT_PROFILER                                          // Profile loop() phases, dump on a long press
 
 #include "FastLED.h"
 #include "DcsBios.h"
-#include "RotaryEncoder.h"
 #include "helpers/Panel.h"
 #include "helpers/Channel.h"
 #include "helpers/Colors.h"
@@ -221,13 +236,20 @@
  * @brief   Define pinouts, LED counts and LED channels 
  * @remark  Check that the pinout corresponds to (YOUR!) wiring.
  * @details Syntax: Channel <Name as on Interconnect>(hardware pin, "Channel name as on PCB", expected max. led count);
- *          When adapting below code, observe memory constraints. Each LED uses 3 bytes of SRAM. 8KB are available.
+ *          When adapting below code, observe memory constraints. Each LED uses 1 byte of SRAM (palette slot index),
+ *          plus 3 bytes per LED of the largest channel for the shared output buffer. 8KB are available.
  ********************************************************************************************************************/
 
 
-// Voltage and current definitions. Adapt to your ATX PSU specs.
+// Voltage and current definitions. Adapt to your ATX PSU specs and to the power injection of each channel.
 const int VOLTAGE = 5;
-const int MAX_MILLIAMPS = 20000;
+const int MAX_MILLIAMPS = 20000;                                      // Whole PSU, limits all channels together
+const int CHANNEL_MAX_MILLIAMPS = 5000;                               // Rating of each channel's power injection
+
+// LED frame pacing: max. time from a DCS-BIOS change to the LEDs, and min. time between two LED frames.
+const int MAX_LATENCY_MS = 20;
+const int MIN_FRAME_INTERVAL_MS = 10;
+const int RAMP_MS = 200;                                              // Time to fade the backlights to a new level
 
 // Hardware pin definitions
 const int encSw =    24;              
@@ -246,17 +268,21 @@ const int RC_2_LED_COUNT = 349;
 const int LC_FLOOD_LED_COUNT = 40;
 const int RC_FLOOD_LED_COUNT = 40;
 
-// Static LED arrays for each channel, using the LED counts defined abv
-CRGB LIP_1_leds[LIP_1_LED_COUNT];    
-CRGB LIP_2_leds[LIP_2_LED_COUNT];    
-CRGB UIP_1_leds[UIP_1_LED_COUNT];    
-CRGB UIP_2_leds[UIP_2_LED_COUNT];    
-CRGB LC_1_leds[LC_1_LED_COUNT];     
-CRGB LC_2_leds[LC_2_LED_COUNT];     
-CRGB RC_1_leds[RC_1_LED_COUNT];     
-CRGB RC_2_leds[RC_2_LED_COUNT];     
-CRGB LC_FLOOD_leds[LC_FLOOD_LED_COUNT];    
-CRGB RC_FLOOD_leds[RC_FLOOD_LED_COUNT];    
+// Static LED arrays for each channel, using the LED counts defined abv (one palette slot index per LED)
+uint8_t LIP_1_leds[LIP_1_LED_COUNT];    
+uint8_t LIP_2_leds[LIP_2_LED_COUNT];    
+uint8_t UIP_1_leds[UIP_1_LED_COUNT];    
+uint8_t UIP_2_leds[UIP_2_LED_COUNT];    
+uint8_t LC_1_leds[LC_1_LED_COUNT];     
+uint8_t LC_2_leds[LC_2_LED_COUNT];     
+uint8_t RC_1_leds[RC_1_LED_COUNT];     
+uint8_t RC_2_leds[RC_2_LED_COUNT];     
+uint8_t LC_FLOOD_leds[LC_FLOOD_LED_COUNT];    
+uint8_t RC_FLOOD_leds[RC_FLOOD_LED_COUNT];    
+
+// Output buffer shared by all channels; must hold the largest channel
+const int OUTPUT_LED_COUNT = RC_2_LED_COUNT;
+CRGB outputLeds[OUTPUT_LED_COUNT];
 
 // Create objects of "channel" class (with the right LED count)
 Channel LIP_1(13, "Channel 1", LIP_1_leds, LIP_1_LED_COUNT);
@@ -276,14 +302,20 @@ Board* board;
 
 /********************************************************************************************************************
  * @brief Standard Arduino setup and loop functions.
- * @remark Setup runs once, loop runs continuously. Conversion CRGB --> GRB is done by FastLED.
+ * @remark Setup runs once, loop runs continuously. Palette index --> CRGB is done by Channel::show(),
+ *         conversion CRGB --> GRB is done by FastLED. LEDs with another color order are declared per channel,
+ *         e.g. addPanel<RadarAltPanel>(RGB), and reordered by Channel::show() before output.
  *         Note that the call to DCS-Bios::loop() is done in the Board.h, where the mode logic resides.
  ********************************************************************************************************************/
 void setup() {
+#ifdef BACKLIGHT_PROFILER
+    Profiler::getInstance()->begin();                                 // Mark the free memory for the stack high-water mark
+#endif
     board = Board::getInstance();                                     // Get board instance
     board->setupRotaryEncoder(encSw, encA, encB);                    // Set up rotary encoder with switch and encoder pins
     
     // Initialize all channels
+    Channel::setOutputBuffer(outputLeds, OUTPUT_LED_COUNT);          // Shared output buffer for all channels
     LIP_1.initialize();                                               // Calling .initialize() on a channel object will
     LIP_2.initialize();                                               // trigger FastLED.addLeds() with pin and led count
     UIP_1.initialize();                                               
@@ -295,13 +327,13 @@ void setup() {
     LC_FLOOD.initialize();
     RC_FLOOD.initialize();
 
-    board->registerChannel(&LIP_1);                                   // Register channels with the board, so they are
-    board->registerChannel(&LIP_2);                                   // accessible by the board object
-    board->registerChannel(&UIP_1);
+    board->registerChannel(&UIP_1, true);                             // Register channels with the board, so they are
+    board->registerChannel(&RC_1, true);                              // accessible by the board object; channels with
+    board->registerChannel(&LIP_1);                                   // true (EWI, caution lights) are output first
+    board->registerChannel(&LIP_2);
     board->registerChannel(&UIP_2);
     board->registerChannel(&LC_1);
     board->registerChannel(&LC_2);
-    board->registerChannel(&RC_1);
     board->registerChannel(&RC_2);
     board->registerChannel(&LC_FLOOD);
     board->registerChannel(&RC_FLOOD);
@@ -320,7 +352,7 @@ void setup() {
 
     LIP_2.addPanel<EcmPanel>();
     LIP_2.addPanel<RwrControlPanel>();
-    LIP_2.addPanel<StandbyInstrumentPanel>();
+    LIP_2.addPanel<StandbyInstrumentPanel>(RGB);                      // RGB ordered LEDs on the GRB strip
 
     LC_1.addPanel<LdgGearPanel>();
     LC_1.addPanel<SelectJettPanel>();
@@ -333,7 +365,7 @@ void setup() {
     LC_2.addPanel<Lc2AllPanels>();
 
     RC_1.addPanel<LdgChecklistPanel>();
-    RC_1.addPanel<RadarAltPanel>();
+    RC_1.addPanel<RadarAltPanel>(RGB);                                // RGB ordered LEDs on the GRB strip
     RC_1.addPanel<HydPressGauge>();
     RC_1.addPanel<CautionPanel>();
     RC_1.addPanel<AvcoolPanel>();
@@ -343,13 +375,25 @@ void setup() {
     LC_FLOOD.addPanel<LcFloodLights>();
     RC_FLOOD.addPanel<RcFloodLights>();
 
-    FastLED.setMaxPowerInVoltsAndMilliamps(VOLTAGE, MAX_MILLIAMPS);   // Set the maximum power in volts and milliamps
+    board->setMaxPower(VOLTAGE, MAX_MILLIAMPS);                       // Set the maximum power in volts and milliamps
+    LIP_1.setMaxPower(VOLTAGE, CHANNEL_MAX_MILLIAMPS);                // Set the power budget of each channel; a channel
+    LIP_2.setMaxPower(VOLTAGE, CHANNEL_MAX_MILLIAMPS);                // over its budget is dimmed on its own
+    UIP_1.setMaxPower(VOLTAGE, CHANNEL_MAX_MILLIAMPS);
+    UIP_2.setMaxPower(VOLTAGE, CHANNEL_MAX_MILLIAMPS);
+    LC_1.setMaxPower(VOLTAGE, CHANNEL_MAX_MILLIAMPS);
+    LC_2.setMaxPower(VOLTAGE, CHANNEL_MAX_MILLIAMPS);
+    RC_1.setMaxPower(VOLTAGE, CHANNEL_MAX_MILLIAMPS);
+    RC_2.setMaxPower(VOLTAGE, CHANNEL_MAX_MILLIAMPS);
+    LC_FLOOD.setMaxPower(VOLTAGE, CHANNEL_MAX_MILLIAMPS);
+    RC_FLOOD.setMaxPower(VOLTAGE, CHANNEL_MAX_MILLIAMPS);
+    board->setFramePacing(MAX_LATENCY_MS, MIN_FRAME_INTERVAL_MS);     // Set the LED frame deadline and rate limit
+    board->setRampTime(RAMP_MS);                                      // Fade backlights on dimmer jumps and mode changes
     FastLED.setMaxRefreshRate(100);                                   // Set the maximum refresh rate to 100 Hz instead of std. 400 Hz. Slightly reduces CPU load.
-    FastLED.show();                                                   // Show the LEDs
     DcsBios::setup();                                                 // Run DCS Bios setup function
 }
 
 void loop() {
+    PROFILE_SCOPE(PHASE_LOOP);
     board->handleModeChange();                                        // Handle mode changes
     board->processMode();                                             // Process current mode, incl. DCS-Bios::loop()
     board->updateLeds();                                              // Update LEDs as needed
@@ -16,11 +16,16 @@
  * @copyright Copyright 2016-2025 OpenHornet. See 2A13-BACKLIGHT_CONTROLLER.ino for details.
  * @brief     The board class is responsible for the physical input/output: catch rotary encoder commands, update LEDs.
  * @details   During setup, a singleton board object is created. It manages the physical update of the LEDs centrally.
- *            It is the only place from which the expensive physical update (FastLED.show() function) is called.
+ *            It is the only place from which the expensive physical update of the LED strips is called. Only the
+ *            channels whose LED arrays actually changed (dirty channels) are output, one channel per segment, so that
+ *            the DCS-BIOS serial RX interrupt is served during the output.
  *            Additionally, it provides the logic to catch rotary encoder commands to cycle between three modes:
  *            - Normal mode 1 (DCS-BIOS controlled)
  *            - Manual mode 2(control backlights with rotary encoder)
  *            - Rainbow test mode 3
+ *            The board also owns the light mode palette: the colors of the dimmable light groups for each position
+ *            of the cockpit light mode switch (DAY/NITE/NVG). It listens to the switch once for all panels; a mode
+ *            change recolors the group slots of the palette, so every affected LED changes in the same frame.
  *********************************************************************************************************************/
 
 
@@ -39,53 +44,295 @@
 #include "DcsBios.h"
 #include "Colors.h"
 #include "LedUpdateState.h"
-#include "RotaryEncoder.h"
+#include "Palette.h"
+#include "InputEvents.h"
+#include "Profiler.h"
 #include "DCS_State_Checker.h"
 
+/**********************************************************************************************************************
+ * @brief   Colors of the dimmable light groups in one cockpit light mode.
+ *********************************************************************************************************************/
+struct LightModeColors {
+    CRGB instr;                                                       // Instrument backlights
+    CRGB console;                                                     // Console backlights
+    CRGB flood;                                                       // Floodlights
+    CRGB station;                                                     // Jettison station select lights
+};
+
+/**********************************************************************************************************************
+ * @brief   Light mode palette: the group colors for each position of the cockpit light mode switch.
+ * @details One row per DCS-BIOS value of COCKKPIT_LIGHT_MODE_SW (0 = DAY, 1 = NITE, 2 = NVG). In DAY mode, the
+ *          jettison station select lights are white, otherwise green.
+ * @remark  This table is stored in PROGMEM; the board keeps a copy of the current row.
+ *********************************************************************************************************************/
+const uint8_t LIGHT_MODES = 3;
+constexpr LightModeColors LIGHT_MODE_COLORS[LIGHT_MODES] PROGMEM = {
+    {NVIS_GREEN_A, NVIS_GREEN_A, NVIS_WHITE, NVIS_WHITE},             // DAY
+    {NVIS_GREEN_A, NVIS_GREEN_A, NVIS_WHITE, NVIS_GREEN_A},           // NITE
+    {NVIS_GREEN_A, NVIS_GREEN_A, NVIS_WHITE, NVIS_GREEN_A}            // NVG
+};
+
+/**********************************************************************************************************************
+ * @brief   Tracks where the DCS-BIOS parser is in the export stream, so that the callbacks only see complete frames.
+ * @details An export frame starts with the frame sync (onConsistentData() of all listeners) and ends with the
+ *          update counter at 0xfffe, the highest address. In between, the export buffers hold a mix of the new
+ *          frame and the previous one. With DCSBIOS_IRQ_SERIAL, both methods run in the RX interrupt.
+ *          A frame whose end does not arrive within EXPORT_FRAME_TIMEOUT_MS (the stream stopped mid-frame) no
+ *          longer counts as being received, so that its values are not held back for good.
+ *          Received bytes that are lost (e.g. an RX overrun) break the frame they belong to, which shows here as a
+ *          frame sync without the update counter before it (incomplete frame), or as a gap in the update counter
+ *          (skipped frames; this also counts frames the sim or a network hop dropped before the serial line).
+ *********************************************************************************************************************/
+class ExportFrameGate : public DcsBios::ExportStreamListener {
+public:
+    static const uint16_t UPDATE_COUNTER_ADDRESS = 0xfffe;            // Written last in every export frame
+    static const uint16_t EXPORT_FRAME_TIMEOUT_MS = 500;              // A full refresh takes tens of ms at 250 kbaud
+
+    ExportFrameGate() : DcsBios::ExportStreamListener(UPDATE_COUNTER_ADDRESS, UPDATE_COUNTER_ADDRESS) {
+        receiving = false;
+        completed = 0;
+        syncMs = 0;
+        counterKnown = false;
+        lastCounter = 0;
+        incompleteFrames = 0;
+        skippedFrames = 0;
+    }
+
+    void onConsistentData() override {                                // Frame sync: the next frame starts
+        if (receiving) incompleteFrames++;                            // The last frame ended without update counter
+        receiving = true;
+        syncMs = millis();
+    }
+
+    void onDcsBiosWrite(unsigned int address, unsigned int value) override {
+        if (address != UPDATE_COUNTER_ADDRESS) return;
+        uint8_t counter = value & 0x00ff;                             // Low byte: incremented with every frame
+        if (counterKnown) skippedFrames += (uint8_t)(counter - lastCounter - 1);
+        lastCounter = counter;
+        counterKnown = true;
+        receiving = false;                                            // Update counter: the frame is complete
+        completed++;
+    }
+
+    /**
+     * @brief Checks whether an export frame is being received, i.e. the export buffers are not consistent
+     */
+    bool isReceiving() const {
+        noInterrupts();                                               // syncMs is written by the RX interrupt
+        bool result = receiving && millis() - syncMs < EXPORT_FRAME_TIMEOUT_MS;
+        interrupts();
+        return result;
+    }
+
+    /**
+     * @brief Gets the number of export frames received completely (wraps around)
+     */
+    uint8_t getCompleted() const { return completed; }
+
+    /**
+     * @brief Gets the number of frames whose update counter did not arrive before the next frame sync
+     */
+    uint32_t getIncompleteFrames() const {
+        noInterrupts();
+        uint32_t result = incompleteFrames;
+        interrupts();
+        return result;
+    }
+
+    /**
+     * @brief Gets the number of frames missing between two received update counters
+     */
+    uint32_t getSkippedFrames() const {
+        noInterrupts();
+        uint32_t result = skippedFrames;
+        interrupts();
+        return result;
+    }
+
+private:
+    volatile bool receiving;                                          // Between frame sync and update counter
+    volatile uint8_t completed;                                       // Export frames received completely
+    volatile unsigned long syncMs;                                    // millis() at the last frame sync
+    bool counterKnown;                                                // An update counter has been received
+    uint8_t lastCounter;                                              // Low byte of the last update counter
+    volatile uint32_t incompleteFrames;                               // Frame syncs without update counter before
+    volatile uint32_t skippedFrames;                                  // Gaps in the update counter, in frames
+};
+
 class Board {
 
 private:
 
-    int updCountdown;                                                 //DCS Bios cycle countdown before invoking FastLED.show()
+    uint16_t maxLatencyMs;                                            // Deadline from first change to output
+    uint16_t minFrameIntervalMs;                                      // Minimum time between two frame starts
+    unsigned long lastFrameMs;                                        // Start time of the last frame
+    unsigned long lastSlotStepMs;                                     // Time of the last ramp or dither step
+    unsigned long frameChangeUs;                                      // Time of the first change output by this frame
+    unsigned long fpsWindowMs;                                        // Start of the current frames per second window
+    uint16_t framesInWindow;                                          // Frames completed in the current window
+    uint16_t framesPerSecond;                                         // Frames completed in the last full second
+    unsigned long lastLatencyUs;                                      // Change-to-photon latency of the last frame
+    unsigned long maxLatencyUs;                                       // Highest change-to-photon latency seen
+    uint32_t lateFrames;                                              // Frames that missed the latency deadline
+    bool dcsFrameEnded;                                               // A DCS-BIOS export frame was completely applied
+    ExportFrameGate frameGate;                                        // Export frame boundaries seen by the parser
+    uint8_t committedFrames;                                          // frameGate count of the last committed frame
     static const int MAX_CHANNELS = 10;                               // Maximum number of channels
     static const int MODE_NORMAL = 1;                                 // Normal DCS-BIOS controlled mode
     static const int MODE_MANUAL = 2;                                 // Manual mode - control backlts with rotary encoder
     static const int MODE_RAINBOW = 3;                                // Rainbow test mode
     Channel* channels[MAX_CHANNELS];                                  // Array of channel pointers
     int channelCount;                                                 // Current number of channels
+    int priorityCount;                                                // Number of priority channels at the array start
+    int outputCursor;                                                 // Next channel to check in the current frame
+    bool frameActive;                                                 // True while a frame is output channel by channel
+    uint8_t frameBrightness;                                          // Brightness used for all channels of the frame
     int thisHue;                                                      // Current hue value for rainbow effect
     int deltaHue;                                                     // Hue change between LEDs for rainbow effect
+    bool rainbowIndexed;                                              // True once the LEDs point to the rainbow slots
     int currentMode;                                                  // Current operating mode
     int mode2_brightness;                                             // Current brightness level (0-255), for manual mode 2
     int mode3_brightness;                                             // Brightness level (0-255) for rainbow mode 3
     int dcs_brightness_console;                                        // Current brightness level (0-65535), for DCS-BIOS controlled mode
     int dcs_brightness_instrument;                                     // Current brightness level (0-65535), for DCS-BIOS controlled mode
     int dcs_brightness_flood;                                          // Current brightness level (0-65535), for DCS-BIOS controlled mode
-    int encSwPin;                                                     // Encoder switch pin
-    RotaryEncoder* encoder;                                           // Pointer to encoder instance
-    int rotary_pos;                                                   // Current rotary encoder position
     static Board* instance;                                           // Static instance pointer to the Board class
     DcsState prevDcsState = DcsState::EXITED;                         // Previous DCS state for transition detection
+    static const uint8_t MAX_SNAPSHOT_RUNS = 128;                     // LED runs of all panels (full pit: 117)
+    uint8_t snapshotSlots[MAX_SNAPSHOT_RUNS];                         // Palette slot of every LED run, all channels
+    Palette::GroupState snapshotGroups;                               // Group slot colors at the time of the snapshot
+    uint16_t snapshotDimmers[3];                                      // Instrument, console and flood dimmer values
+    bool snapshotValid;                                               // True once a snapshot was taken
+    uint8_t lightMode;                                                // Position of the cockpit light mode switch
+    LightModeColors modeColors;                                       // Group colors of the current light mode
+    uint32_t maxPower_mW;                                             // Power limit for all channels (0 = unlimited)
+    uint8_t lastOutputBrightness;                                     // Brightness of the last frame after the limit
+    uint32_t abortedSegments;                                         // Segments cut short by a long interrupt
+    uint32_t forcedSegments;                                          // Segments output with the RX interrupt masked
+    uint8_t segmentAborts[MAX_CHANNELS];                              // Aborts in a row, per channel
+    static const uint8_t LED_OUTPUT_US = 30;                          // WS2812B output time per LED (24 bit @ 800 kHz)
+    static const uint8_t MAX_SEGMENT_ABORTS = 3;                      // Aborts in a row before a segment is forced
+#ifdef BACKLIGHT_PROFILER
+    static const uint16_t PROFILE_PRESS_MS = 2000;                    // Switch hold time that dumps the profiler
+    unsigned long pressMs;                                            // Time of the last switch press
+#endif
     
     /**
      * @brief Private constructor to enforce singleton pattern
      * @see This method is called by getInstance() when creating the singleton instance
      */
     Board() {
-        updCountdown = 0;                                             // Initialize with 0
+        maxLatencyMs = 20;                                            // Initialize with 20 ms deadline
+        minFrameIntervalMs = 10;                                      // Initialize with 10 ms (max. 100 frames/s)
+        lastFrameMs = 0;                                              // Initialize with 0
+        lastSlotStepMs = 0;                                           // Initialize with 0
+        frameChangeUs = 0;                                            // Initialize with 0
+        fpsWindowMs = 0;                                              // Initialize with 0
+        framesInWindow = 0;                                           // Initialize with 0
+        framesPerSecond = 0;                                          // Initialize with 0
+        lastLatencyUs = 0;                                            // Initialize with 0
+        maxLatencyUs = 0;                                             // Initialize with 0
+        lateFrames = 0;                                               // Initialize with 0
+        dcsFrameEnded = false;                                        // Initialize without completed export frame
+        committedFrames = 0;                                          // Initialize with 0
         channelCount = 0;                                             // Initialize with 0 channels
+        priorityCount = 0;                                            // Initialize with 0 priority channels
+        outputCursor = 0;                                             // Initialize with 0
+        frameActive = false;                                          // Initialize without pending frame
+        frameBrightness = 255;                                        // Initialize with full brightness
         thisHue = 0;                                                  // Initialize with 0
         deltaHue = 3;                                                 // Initialize with 3
+        rainbowIndexed = false;                                       // Initialize with false
         currentMode = MODE_NORMAL;                                    // Initialize to normal mode 1
         mode2_brightness = 64;                                        // Initialize manual mode 2 brightness to 25%
         mode3_brightness = 64;                                        // Initialize rainbow mode 3 brightness to 25%
         dcs_brightness_console = 0;                                   // Initialize DCS brightness to 0
         dcs_brightness_instrument = 0;                                // Initialize DCS brightness to 0
         dcs_brightness_flood = 0;                                     // Initialize DCS brightness to 0
-        rotary_pos = 0;                                               // Initialize with 0
-        encoder = nullptr;                                            // Initialize with nullptr
+        snapshotValid = false;                                        // Initialize without snapshot
+        lightMode = 0;                                                // Initialize with DAY mode
+        memcpy_P(&modeColors, &LIGHT_MODE_COLORS[0], sizeof(LightModeColors));
+        maxPower_mW = 0;                                              // Initialize without power limit
+        lastOutputBrightness = 255;                                   // Initialize with full brightness
+        abortedSegments = 0;                                          // Initialize with 0
+        forcedSegments = 0;                                           // Initialize with 0
+        memset(segmentAborts, 0, sizeof(segmentAborts));              // Initialize without aborts
+#ifdef BACKLIGHT_PROFILER
+        pressMs = 0;                                                  // Initialize with 0
+#endif
     }
 
+    /**
+     * @brief Outputs one channel as a bounded segment of the frame
+     * @details Each channel is one segment: its strip latches on its own data pin, so interrupts can be served
+     *          between segments without corrupting the frame. With FASTLED_ALLOW_INTERRUPTS, FastLED additionally
+     *          opens an interrupt window after every LED. If an interrupt handler runs longer than the WS2812B
+     *          latch time, FastLED aborts the strip; such a segment returns early and is output again with the next
+     *          frame. After MAX_SEGMENT_ABORTS aborts in a row, the segment is forced: it is output with the RX
+     *          interrupt masked, so that a large channel cannot starve under sustained DCS-BIOS traffic.
+     *          RX budget: the UART holds two received bytes, so no byte is lost as long as the RX interrupt is held
+     *          off for less than two byte times, 80 us at 250 kbaud. A normal segment holds it off for one LED,
+     *          30 us, which leaves 50 us for the RX interrupt itself and the other interrupts. A forced segment
+     *          holds it off for the whole strip (e.g. RC2: 349 LEDs, 10.5 ms, about 260 bytes), and the bytes lost
+     *          show up as incomplete or skipped export frames (see ExportFrameGate).
+     * @note    The host build measures the RX hold-off windows in simulated time (make replay-demo, make test);
+     *          the run time of the RX interrupt itself has not been measured on hardware. The abort detection
+     *          assumes that an aborted strip returns before 75% of its wire time. With BACKLIGHT_PROFILER, the
+     *          counters are sent with the profiler dump, see dumpOutputCounters().
+     * @param index Position of the dirty channel to output in channels
+     * @param brightness The brightness to output with
+     * @see This method is called by updateLeds()
+     */
+    void outputSegment(uint8_t index, uint8_t brightness) {
+        PROFILE_SCOPE(PHASE_OUTPUT);
+        Channel* channel = channels[index];
+#if FASTLED_ALLOW_INTERRUPTS
+        if (segmentAborts[index] < MAX_SEGMENT_ABORTS) {
+            unsigned long start = micros();
+            channel->show(brightness);
+            unsigned long elapsed = micros() - start;
+            unsigned long expected = (unsigned long)channel->getLedCount() * LED_OUTPUT_US;
+            if (elapsed >= expected - expected / 4) {                 // Full wire time: the strip was output
+                segmentAborts[index] = 0;
+                return;
+            }
+            abortedSegments++;                                        // Returned early: strip output was aborted
+            segmentAborts[index]++;
+            channel->markDirty();
+            LedUpdateState::getInstance()->setUpdateFlag(true);
+            return;
+        }
+        segmentAborts[index] = 0;
+        forcedSegments++;
+#ifdef UCSR0B
+        UCSR0B &= ~_BV(RXCIE0);                                       // FastLED reopens interrupts between LEDs, so
+#endif
+        channel->show(brightness);                                    // only the RX interrupt is masked
+#ifdef UCSR0B
+        UCSR0B |= _BV(RXCIE0);
+#endif
+#else
+        cli();                                                        // Without interrupt windows, the whole segment
+        channel->show(brightness);                                    // runs with interrupts off
+        sei();
+#endif
+    }
+
+#ifdef BACKLIGHT_PROFILER
+    /**
+     * @brief Sends the segment and export frame loss counters as a BL_PROFILE message, after the profiler dump
+     * @details E.g. "SEGMENTS aborted=3 forced=0 EXPORT incomplete=0 skipped=2", counted since start.
+     * @see This method is called by handleModeChange() on a long press of the encoder switch
+     */
+    void dumpOutputCounters() {
+        char line[96];
+        snprintf(line, sizeof(line), "SEGMENTS aborted=%lu forced=%lu EXPORT incomplete=%lu skipped=%lu",
+                 (unsigned long)abortedSegments, (unsigned long)forcedSegments,
+                 (unsigned long)frameGate.getIncompleteFrames(), (unsigned long)frameGate.getSkippedFrames());
+        sendDcsBiosMessage("BL_PROFILE", line);
+    }
+#endif
+
 
 public:
 
@@ -94,7 +341,12 @@ public:
      * @see This method is called by setup() in 2A13-BACKLIGHT_CONTROLLER.ino
      */
     static Board* getInstance() {
-        return instance ? instance : (instance = new Board()); }
+        if (!instance) {
+            static Board board;
+            instance = &board;                                        // Static storage, no heap allocation
+        }
+        return instance;
+    }
 
     /**
      * @brief Sets up the rotary encoder with switch and encoder pins
@@ -104,83 +356,298 @@ public:
      * @see This method is called by setup() in 2A13-BACKLIGHT_CONTROLLER.ino
      */
     void setupRotaryEncoder(int encSwPin, int encAPin, int encBPin) {
-        this->encSwPin = encSwPin;
-        pinMode(encSwPin, INPUT_PULLUP);                              // Initialize mode change pin
-        encoder = new RotaryEncoder(encAPin, encBPin, RotaryEncoder::LatchMode::TWO03);
+        InputEvents::getInstance()->begin(encSwPin, encAPin, encBPin);  // Sampled in the Timer0 interrupt from now on
     }
 
     /**
      * @brief Registers a channel with the board
+     * @details Priority channels are output first in every frame, in the order they were registered, followed by
+     *          the other channels in their registration order.
      * @param channel Pointer to the channel to register
+     * @param priority True for channels carrying indicator lights that should reach the strips first
+     * @see This method is called by setup() in 2A13-BACKLIGHT_CONTROLLER.ino
+     */
+    void registerChannel(Channel* channel, bool priority = false) {
+        if (channelCount >= MAX_CHANNELS) return;
+        if (priority) {
+            for (int i = channelCount; i > priorityCount; i--) channels[i] = channels[i - 1];
+            channels[priorityCount++] = channel;
+            channelCount++;
+        } else {
+            channels[channelCount++] = channel;
+        }
+    }
+
+    /**
+     * @brief Sets the power limit of the whole PSU, applied to all channels together
+     * @details A backstop on top of the channel budgets (see Channel::setMaxPower()): if the pit as a whole would
+     *          draw more, all channels are dimmed alike, as FastLED's global power limit does.
+     * @param volts Supply voltage
+     * @param milliamps Maximum current for all channels together
+     * @see This method is called by setup() in 2A13-BACKLIGHT_CONTROLLER.ino
+     */
+    void setMaxPower(uint8_t volts, uint32_t milliamps) {
+        maxPower_mW = (uint32_t)volts * milliamps;
+    }
+
+    /**
+     * @brief Sets the timing of the LED frame pacer
+     * @param maxLatencyMs Maximum time from the first change to its output; a late frame is output in one go
+     * @param minFrameIntervalMs Minimum time between two frame starts; changes within it are merged (max. maxLatencyMs)
+     * @see This method is called by setup() in 2A13-BACKLIGHT_CONTROLLER.ino
+     */
+    void setFramePacing(uint16_t maxLatencyMs, uint16_t minFrameIntervalMs) {
+        this->maxLatencyMs = maxLatencyMs;
+        this->minFrameIntervalMs = min(minFrameIntervalMs, maxLatencyMs);
+    }
+
+    /**
+     * @brief Sets the time over which the instrument, console and flood lights move to a new brightness
+     * @details Avoids hard cuts and current steps on dimmer jumps and mode changes. Turning lights off and
+     *          restoring a snapshot stay immediate.
+     * @param ms Ramp time in milliseconds (0 = no ramp)
      * @see This method is called by setup() in 2A13-BACKLIGHT_CONTROLLER.ino
      */
-    void registerChannel(Channel* channel) {
-        channels[channelCount++] = channel;
+    void setRampTime(uint16_t ms) {
+        Palette::getInstance()->setRampTime(ms);
     }
 
     /**
      * @brief Update the physical LED state
+     * @details While DCS is running in normal mode, a frame is only started after a DCS-BIOS export frame has been
+     *          applied completely, so that no half-applied states are shown and there is one output per sim frame.
+     *          When paused, exited or in manual and rainbow mode, a time-based pacer decides when to output: the first
+     *          change after an idle period starts a frame at once, further changes are merged until the minimum frame
+     *          interval has passed. A frame outputs the dirty
+     *          channels, one channel per call, so that the encoder and the DCS-BIOS RX interrupt are served between
+     *          the strips; the longest loop() is bounded by the largest channel instead of the whole frame. Only if
+     *          the maximum latency is exceeded, the rest of the frame is output at once. Priority channels are output
+     *          first. With DCSBIOS_IRQ_SERIAL, the DCS-BIOS callbacks only run on a complete export frame and not
+     *          while an LED frame is pending or output (see pollDcsBios()), so every channel shows the same export
+     *          frame. Without it, the parser runs in DcsBios::loop() and cannot wait, so changes received during an
+     *          LED frame can reach the channels not yet output.
+     *          Interrupts stay enabled between the channel segments, see outputSegment(). Power limits are applied
+     *          per channel by Channel::show(), and for the whole PSU by startFrame().
+     *          A ramp step of the group slots (see setRampTime()) and, with BACKLIGHT_DITHERING, a dither step
+     *          also start a frame, at most once per minimum frame interval and never before the previous frame is
+     *          out. While DCS is running, they are taken at the export frame end, together with the changes of that
+     *          frame. No frames are scheduled once all groups have reached their targets and no dithered group
+     *          (see Palette::dither()) is lit.
      * @see This method is called by loop() in 2A13-BACKLIGHT_CONTROLLER.ino
      */
-    void updateLeds() {                                               
-        if (LedUpdateState::getInstance()->getUpdateFlag()) {
-            updCountdown = (updCountdown == 0) ? 32 : updCountdown;   // Countdown logic allows to collect LED updates
-            updCountdown--;                                           // from 32 loop() calls into one FastLED.show()
-            if (updCountdown == 0) {                                  // Trigger FastLED.show() at end of countdown
-                cli();
-                FastLED.show();                                       
-                LedUpdateState::getInstance()->setUpdateFlag(false);  // Reset update flag
-                sei();
-            }
+    void updateLeds() {
+        PROFILE_SCOPE(PHASE_LEDS);
+        unsigned long now = millis();
+        LedUpdateState* state = LedUpdateState::getInstance();
+        bool dcsActive = currentMode == MODE_NORMAL &&
+                         prevDcsState != DcsState::EXITED && prevDcsState != DcsState::PAUSED;
+        if (!frameActive && (dcsFrameEnded || !dcsActive)             // DCS running: step with the export frame
+            && now - lastSlotStepMs >= minFrameIntervalMs) {          // One step per frame interval
+            lastSlotStepMs = now;
+            Palette* palette = Palette::getInstance();
+            if (palette->isRamping()) palette->ramp(now);             // Dimmer changes are faded in over frames
+#ifdef BACKLIGHT_DITHERING
+            palette->dither();                                        // Fractional dimmer levels need ongoing frames
+#endif
+        }
+        if (!state->getUpdateFlag()) dcsFrameEnded = false;           // Frame end without changes: nothing to commit
+        if (!frameActive && state->getUpdateFlag()
+            && (dcsFrameEnded || !dcsActive)                          // DCS running: commit on export frame end only
+            && now - lastFrameMs >= minFrameIntervalMs) {             // Idle: immediately, burst: after the interval
+            dcsFrameEnded = false;
+            startFrame(now);
+        }
+        if (frameActive) {
+            bool late = micros() - frameChangeUs >= (unsigned long)maxLatencyMs * 1000UL;
+            do {
+                outputNextChannel();
+            } while (late && frameActive);                            // Deadline missed: output the rest at once
+            if (!frameActive) finishFrame();
+        }
+        if (now - fpsWindowMs >= 1000) {                              // Update the frames per second counter
+            framesPerSecond = framesInWindow;
+            framesInWindow = 0;
+            fpsWindowMs = now;
+        }
+    }
+
+    /**
+     * @brief Starts a frame: snapshots the power limited global brightness and resets the update flag
+     * @details If the PSU limit requires another brightness than the last frame, all channels are output, so that
+     *          they share the same brightness.
+     * @param now Current time in milliseconds
+     * @see This method is called by updateLeds()
+     */
+    void startFrame(unsigned long now) {
+        LedUpdateState* state = LedUpdateState::getInstance();
+        uint8_t brightness = FastLED.getBrightness();
+        if (maxPower_mW > 0) {                                        // Same power model as FastLED, from the palette
+            uint32_t required_mW = 0;
+            for (int i = 0; i < channelCount; i++) required_mW += channels[i]->getPower_mW();
+            required_mW = required_mW * brightness / 256;
+            if (required_mW > maxPower_mW) brightness = (uint32_t)brightness * maxPower_mW / required_mW;
         }
+        if (brightness != lastOutputBrightness) {                     // PSU scale changed: refresh all channels
+            for (int i = 0; i < channelCount; i++) channels[i]->markDirty();
+            lastOutputBrightness = brightness;
+        }
+        frameChangeUs = state->getFirstChangeMicros();
+        state->setUpdateFlag(false);                                  // Reset before output: later changes set it again
+        frameBrightness = brightness;
+        outputCursor = 0;
+        frameActive = true;
+        lastFrameMs = now;
     }
 
+    /**
+     * @brief Records the latency and frame counters after the last channel of a frame was output
+     * @see This method is called by updateLeds()
+     */
+    void finishFrame() {
+        lastLatencyUs = micros() - frameChangeUs;
+        if (lastLatencyUs > maxLatencyUs) maxLatencyUs = lastLatencyUs;
+        if (lastLatencyUs > (unsigned long)maxLatencyMs * 1000UL) lateFrames++;
+        framesInWindow++;
+    }
 
     /**
-     * @brief Handles mode change button press and returns current mode
-     * @return The current mode after handling the button press
+     * @brief Outputs the next dirty channel of the current frame and ends the frame after the last channel
+     * @details A channel that becomes dirty again after its turn in this frame is output with the next frame.
+     * @see This method is called by updateLeds()
+     */
+    void outputNextChannel() {
+        while (outputCursor < channelCount && !channels[outputCursor]->isDirty()) outputCursor++;
+        if (outputCursor < channelCount) {
+            outputSegment(outputCursor++, frameBrightness);
+        }
+        if (outputCursor >= channelCount) frameActive = false;
+    }
+
+
+    /**
+     * @brief Gets the number of DCS-BIOS export frames broken or missed on the way in (incomplete plus skipped)
+     * @details Lost bytes are counted where they break the export stream, once per frame they affect.
+     */
+    uint32_t getLostExportFrames() const { return frameGate.getIncompleteFrames() + frameGate.getSkippedFrames(); }
+
+    /**
+     * @brief Gets the number of segments aborted by FastLED and re-output with the next frame
+     */
+    uint32_t getAbortedSegments() const { return abortedSegments; }
+
+    /**
+     * @brief Gets the number of segments output with the RX interrupt masked after MAX_SEGMENT_ABORTS aborts
+     */
+    uint32_t getForcedSegments() const { return forcedSegments; }
+
+    /**
+     * @brief Gets the number of frames output during the last full second
+     */
+    uint16_t getFramesPerSecond() const { return framesPerSecond; }
+
+    /**
+     * @brief Gets the time from the first change to the end of the output of the last frame
+     */
+    unsigned long getLastLatencyUs() const { return lastLatencyUs; }
+
+    /**
+     * @brief Gets the highest change-to-photon latency seen since start
+     */
+    unsigned long getMaxLatencyUs() const { return maxLatencyUs; }
+
+    /**
+     * @brief Gets the number of frames whose latency exceeded the maximum latency
+     */
+    uint32_t getLateFrames() const { return lateFrames; }
+
+
+    /**
+     * @brief Handles the queued encoder events and returns current mode
+     * @details A switch press cycles the mode, encoder detents adjust the brightness in manual and rainbow mode.
+     *          The events are queued by the Timer0 interrupt (see InputEvents.h), so no detent is lost while
+     *          loop() is busy with a long strip output.
+     *          With BACKLIGHT_PROFILER, the mode changes on the release of a short press instead, and holding the
+     *          switch for PROFILE_PRESS_MS dumps the profiler statistics (see Profiler.h) and the segment counters
+     *          (see dumpOutputCounters()) without changing the mode.
+     * @return The current mode after handling the events
      * @see This method is called by loop() in 2A13-BACKLIGHT_CONTROLLER.ino
      */
     int handleModeChange() {
-        static bool lastButtonState = HIGH;
+        PROFILE_SCOPE(PHASE_INPUT);
+        InputEvents::Event event;
+        while (InputEvents::getInstance()->pop(event)) {
+            switch (event) {
+#ifdef BACKLIGHT_PROFILER
+                case InputEvents::PRESS:            pressMs = millis(); break;
+                case InputEvents::RELEASE:
+                    if (millis() - pressMs >= PROFILE_PRESS_MS) {
+                        Profiler::getInstance()->dump();
+                        dumpOutputCounters();
+                    } else {
+                        changeMode();
+                    }
+                    break;
+#else
+                case InputEvents::PRESS:            changeMode();       break;
+#endif
+                case InputEvents::CLOCKWISE:        turnEncoder(true);  break;
+                case InputEvents::COUNTERCLOCKWISE: turnEncoder(false); break;
+                default:                                                break;
+            }
+        }
+        return currentMode;
+    }
+
+    /**
+     * @brief Cycles to the next mode on a switch press
+     * @see This method is called by handleModeChange()
+     */
+    void changeMode() {
         static unsigned long lastButtonPressTime = 0;
         const unsigned long BUTTON_WAIT = 1000;                       // Wait time in milliseconds between button presses
-        
-        bool currentButtonState = digitalRead(encSwPin);              // Read the state of the encoder switch
-        unsigned long currentTime = millis();                          // Get current time in milliseconds
-        
-        if (currentButtonState == LOW && lastButtonState == HIGH) {   // Button has just been pressed
-            if (currentTime - lastButtonPressTime < BUTTON_WAIT) {    // Only process if 1 sec passed since last press
-                lastButtonState = currentButtonState;
-                return currentMode;
-            }
-            lastButtonPressTime = currentTime;                        // Update last press time
-            int previousMode = currentMode;                           // Store previous mode
-            currentMode = (currentMode % 3) + 1;                      // Cycle to next mode
-            
-            if (currentMode == MODE_NORMAL) {
-                setAllLightsOff();
-                sendDcsBiosMessage("CONSOLES_DIMMER", String(dcs_brightness_console).c_str());           // Send DCS-BIOS message to reset console dimmer
-                sendDcsBiosMessage("INST_PNL_DIMMER", String(dcs_brightness_instrument).c_str());        // Send DCS-BIOS message to reset instrument lighting
-                sendDcsBiosMessage("FLOOD_DIMMER", String(dcs_brightness_flood).c_str());                  // Send DCS-BIOS message to reset floodlights dimmer
-            }
-            if (currentMode == MODE_MANUAL) {
-                mode2_brightness = 64;                                // Reset to 25% brightness
-                fillSolid(NVIS_GREEN_A);                              // Apply the brightness immediately
-            }
-            if (currentMode == MODE_RAINBOW) {
-                mode3_brightness = 64;                                // Reset to 25% brightness
-                encoder->tick();                                      // Update encoder state
-                rotary_pos = encoder->getPosition();                  // Sync encoder position to avoid false change detection
-                setAllLightsOff();                                    // Clear any previous state
-            }
 
-            lastButtonState = currentButtonState;
-            delay(10);                                                // Small delay to debounce switch
-        } else {
-            lastButtonState = currentButtonState;
+        unsigned long currentTime = millis();                         // Get current time in milliseconds
+        if (currentTime - lastButtonPressTime < BUTTON_WAIT) return;  // Only process if 1 sec passed since last press
+        lastButtonPressTime = currentTime;                            // Update last press time
+        currentMode = (currentMode % 3) + 1;                          // Cycle to next mode
+
+        if (currentMode == MODE_NORMAL) {
+            setAllLightsOff();
+            sendDcsBiosMessage("CONSOLES_DIMMER", String(dcs_brightness_console).c_str());           // Send DCS-BIOS message to reset console dimmer
+            sendDcsBiosMessage("INST_PNL_DIMMER", String(dcs_brightness_instrument).c_str());        // Send DCS-BIOS message to reset instrument lighting
+            sendDcsBiosMessage("FLOOD_DIMMER", String(dcs_brightness_flood).c_str());                  // Send DCS-BIOS message to reset floodlights dimmer
+        }
+        if (currentMode == MODE_MANUAL) {
+            mode2_brightness = 64;                                    // Reset to 25% brightness
+            fillSolid(NVIS_GREEN_A);                                  // Apply the brightness immediately
+        }
+        if (currentMode == MODE_RAINBOW) {
+            mode3_brightness = 64;                                    // Reset to 25% brightness
+            setAllLightsOff();                                        // Clear any previous state
+            rainbowIndexed = false;                                   // LEDs are pointed to the rainbow slots again
         }
-        return currentMode;
+    }
+
+    /**
+     * @brief Adjusts the brightness of manual mode 2 or rainbow mode 3 by one encoder detent
+     * @param clockwise True for a clockwise detent (brighter)
+     * @see This method is called by handleModeChange()
+     */
+    void turnEncoder(bool clockwise) {
+        if (currentMode == MODE_MANUAL) {
+            if (clockwise) {
+                mode2_brightness = (mode2_brightness < 224) ? mode2_brightness + 32 : 255;  // Add 32 or cap at 255
+            } else {
+                mode2_brightness = (mode2_brightness > 32) ? mode2_brightness - 32 : 0;  // Subtract 32 or cap at 0
+            }
+            fillSolid(NVIS_GREEN_A);
+        } else if (currentMode == MODE_RAINBOW) {
+            if (clockwise) {
+                mode3_brightness = (mode3_brightness < 224) ? mode3_brightness + 32 : 255;  // Add 32 or cap at 255
+            } else {
+                mode3_brightness = (mode3_brightness > 32) ? mode3_brightness - 32 : 0;  // Subtract 32 or cap at 0
+            }
+        }                                                             // Normal mode 1: detents are ignored
     }
 
     /**
@@ -188,66 +655,116 @@ public:
      * @see This method is called by loop() in 2A13-BACKLIGHT_CONTROLLER.ino
      */
     void processMode() {
-        int newPos = 0;  
+        PROFILE_SCOPE(PHASE_MODE);
         switch(currentMode) {
             case MODE_NORMAL:                                         // MODE 1: LEDs controlled by DCS BIOS
                 {
                     DcsState currentDcsState = getDcsState();
+                    bool wasActive = prevDcsState != DcsState::EXITED && prevDcsState != DcsState::PAUSED;
+                    bool isActive = currentDcsState != DcsState::EXITED && currentDcsState != DcsState::PAUSED;
+                    if (wasActive && !isActive) takeSnapshot();       // DCS paused or exited: remember the pit's lighting
                     if (currentDcsState == DcsState::EXITED && prevDcsState != DcsState::EXITED) {
                         setAllLightsOff();                            // DCS just exited: turn off all lights
-                    } else if (prevDcsState == DcsState::EXITED &&
-                               currentDcsState != DcsState::EXITED &&
-                               currentDcsState != DcsState::PAUSED) {
-                        for (int i = 0; i < channelCount; i++) {     // DCS became active again: restore last known brightness
-                            channels[i]->updateInstrLights(dcs_brightness_instrument);
-                            channels[i]->updateConsoleLights(dcs_brightness_console);
-                            channels[i]->updateFloodLights(dcs_brightness_flood);
+                    } else if (prevDcsState == DcsState::EXITED && isActive) {
+                        if (snapshotValid) {
+                            restoreSnapshot();                        // DCS became active again: pit back in one frame
+                        } else {
+                            updateInstrumentLights(dcs_brightness_instrument);  // No snapshot yet: restore last
+                            updateConsoleLights(dcs_brightness_console);          // known brightness
+                            updateFloodLights(dcs_brightness_flood);
                         }
-                        LedUpdateState::getInstance()->setUpdateFlag(true);
                     }
                     // PAUSED: do nothing - keep current light state
                     prevDcsState = currentDcsState;
-                    DcsBios::loop();
+                    {
+                        PROFILE_SCOPE(PHASE_DCSBIOS);
+                        pollDcsBios();                                // Panel callbacks on complete export frames
+                    }
                 }
                 break;
             case MODE_MANUAL:                                         // MODE 2: LEDs controlled manually through BKLT switch
-                encoder->tick();
-                newPos = encoder->getPosition();
-                if (newPos != rotary_pos) {
-                    RotaryEncoder::Direction direction = encoder->getDirection();
-                    if (direction == RotaryEncoder::Direction::CLOCKWISE) {
-                        mode2_brightness = (mode2_brightness < 224) ? mode2_brightness + 32 : 255;  // Add 32 or cap at 255
-                    } else {
-                        mode2_brightness = (mode2_brightness > 32) ? mode2_brightness - 32 : 0;  // Subtract 32 or cap at 0
-                    }
-                    rotary_pos = newPos;
-                    fillSolid(NVIS_GREEN_A);                          
-                }
-                break;   
+                break;                                                // Brightness is set by turnEncoder()
             case MODE_RAINBOW:                                        // MODE 3: Rainbow test mode
-                encoder->tick();
-                newPos = encoder->getPosition();
-                if (newPos != rotary_pos) {
-                    RotaryEncoder::Direction direction = encoder->getDirection();
-                    if (direction == RotaryEncoder::Direction::CLOCKWISE) {
-                        mode3_brightness = (mode3_brightness < 224) ? mode3_brightness + 32 : 255;  // Add 32 or cap at 255
-                    } else {
-                        mode3_brightness = (mode3_brightness > 32) ? mode3_brightness - 32 : 0;  // Subtract 32 or cap at 0
-                    }
-                    rotary_pos = newPos;
+                if (!rainbowIndexed) {                                // Point all LEDs to the rainbow slots once
+                    for (int i = 0; i < channelCount; i++) channels[i]->fillRainbow(deltaHue);
+                    rainbowIndexed = true;
                 }
-                for (int i = 0; i < channelCount; i++) {
-                    fill_rainbow(channels[i]->getLeds(), channels[i]->getLedCount(), thisHue, deltaHue);
-                    // Scale down brightness to reduce maximum brightness
-                    nscale8_video(channels[i]->getLeds(), channels[i]->getLedCount(), mode3_brightness);
+                for (uint8_t k = 0; k < Palette::RAINBOW_SLOTS; k++) {  // Rotating the slot hues moves the rainbow
+                    CRGB color;
+                    hsv2rgb_rainbow(CHSV(thisHue + k * (256 / Palette::RAINBOW_SLOTS), 240, 255), color);
+                    color.nscale8_video(mode3_brightness);            // Scale down brightness to reduce maximum brightness
+                    Palette::getInstance()->setColor(Palette::SLOT_RAINBOW + k, color);
                 }
                 thisHue++;  // Increment the hue for the next frame
-                LedUpdateState::getInstance()->setUpdateFlag(true);
                 break;
         }
     }
 
 
+    /**
+     * @brief Runs the DCS-BIOS callbacks and commits a complete export frame for output
+     * @details With DCSBIOS_IRQ_SERIAL, the RX interrupt parses into the export buffers at any time. Their callbacks
+     *          only run while no LED frame is pending or output and no export frame is being received, so that all
+     *          buffers hold the same, complete frame (frames received meanwhile are skipped, the buffers keep the
+     *          latest values). If the next frame starts while the callbacks run, their changes stay pending and are
+     *          committed after the callbacks have run once more on a complete frame.
+     *          Without it, the parser runs in DcsBios::loop(); a frame is committed after a call that received its
+     *          update counter and did not start the next frame.
+     * @see This method is called by processMode() in normal mode
+     */
+    void pollDcsBios() {
+#ifdef DCSBIOS_IRQ_SERIAL
+        if (frameActive || dcsFrameEnded || frameGate.isReceiving()) return;
+#endif
+        uint8_t completed = frameGate.getCompleted();
+        DcsBios::loop();                                              // Parser (without IRQ serial) and callbacks
+#ifdef DCSBIOS_IRQ_SERIAL
+        if (frameGate.getCompleted() != completed) return;            // A whole frame arrived meanwhile: run again
+#else
+        completed = frameGate.getCompleted();
+#endif
+        if (completed != committedFrames && !frameGate.isReceiving()) {
+            committedFrames = completed;
+            dcsFrameEnded = true;
+        }
+    }
+
+    /**
+     * @brief Takes a snapshot of the lighting state: dimmer values, group slot colors and the slot of every LED run
+     * @details All LEDs of a run share one slot, so the snapshot holds one byte per run (117 bytes for a full pit)
+     *          instead of one per LED, in a buffer of MAX_SNAPSHOT_RUNS bytes. If the panels have more runs, no
+     *          snapshot is taken and DCS coming back restores the last dimmer values only.
+     * @see This method is called by processMode() when DCS pauses or exits
+     */
+    void takeSnapshot() {
+        uint16_t runs = 0;
+        for (int i = 0; i < channelCount; i++) runs += channels[i]->getRunCount();
+        if (runs > MAX_SNAPSHOT_RUNS) return;                         // Too many runs: increase MAX_SNAPSHOT_RUNS
+        uint8_t* out = snapshotSlots;
+        for (int i = 0; i < channelCount; i++) out = channels[i]->saveSnapshot(out);
+        Palette::getInstance()->saveGroups(snapshotGroups);
+        snapshotDimmers[0] = dcs_brightness_instrument;
+        snapshotDimmers[1] = dcs_brightness_console;
+        snapshotDimmers[2] = dcs_brightness_flood;
+        snapshotValid = true;
+    }
+
+    /**
+     * @brief Restores the last snapshot with one bulk write of the LED indices and outputs it with the next frame
+     * @details Indicators come back with their last state instead of staying dark until DCS sends them again.
+     *          The frame is started without waiting for the end of a DCS-BIOS export frame.
+     * @see This method is called by processMode() when DCS becomes active again after an exit
+     */
+    void restoreSnapshot() {
+        Palette::getInstance()->restoreGroups(snapshotGroups);
+        const uint8_t* in = snapshotSlots;
+        for (int i = 0; i < channelCount; i++) {
+            in = channels[i]->restoreSnapshot(in, snapshotDimmers[0], snapshotDimmers[1], snapshotDimmers[2]);
+        }
+        dcsFrameEnded = true;
+    }
+
+
     /**
      * @brief Fills all channels with a solid color
      * @param color The color to fill with
@@ -260,7 +777,6 @@ public:
             channels[i]->updateInstrLights(map(targetBrightness, 0, 255, 0, 65535), color);
             channels[i]->updateConsoleLights(map(targetBrightness, 0, 255, 0, 65535), color);
         }
-        LedUpdateState::getInstance()->setUpdateFlag(true);
     }
 
     /**
@@ -271,7 +787,6 @@ public:
         for (int i = 0; i < channelCount; i++) {
             channels[i]->setAllLightsOff();
         }
-        LedUpdateState::getInstance()->setUpdateFlag(true);
     }
 
     /**
@@ -283,10 +798,10 @@ public:
         dcs_brightness_instrument = newValue;                         // In any mode, store the DCS-BIOS brightness value
         if (currentMode != MODE_NORMAL) return;                       // But only in normal mode, actually send update to channels
         for (int i = 0; i < channelCount; i++) {
-            channels[i]->updateInstrLights(newValue);
+            channels[i]->updateInstrLights(newValue, modeColors.instr);
         }
-        LedUpdateState::getInstance()->setUpdateFlag(true);
-        
+        uint16_t stationScale = newValue ? 0xff00 : 0;                // Station lights: full on while the dimmer is on
+        Palette::getInstance()->setGroupLevel(Palette::SLOT_STATION, modeColors.station, stationScale);
     }
 
     /**
@@ -298,10 +813,8 @@ public:
         dcs_brightness_console = newValue;                            // In any mode, store the DCS-BIOS brightness value
         if (currentMode != MODE_NORMAL) return;                       // But only in normal mode, actually send update to channels
         for (int i = 0; i < channelCount; i++) {
-            channels[i]->updateConsoleLights(newValue);
+            channels[i]->updateConsoleLights(newValue, modeColors.console);
         }
-        LedUpdateState::getInstance()->setUpdateFlag(true);
-        
     }
 
     /**
@@ -313,10 +826,28 @@ public:
         dcs_brightness_flood = newValue;                              // In any mode, store the DCS-BIOS brightness value
         if (currentMode != MODE_NORMAL) return;                       // But only in normal mode, actually send update to channels
         for (int i = 0; i < channelCount; i++) {
-            channels[i]->updateFloodLights(newValue);
+            channels[i]->updateFloodLights(newValue, modeColors.flood);
         }
-        LedUpdateState::getInstance()->setUpdateFlag(true);
-        
+    }
+
+    /**
+     * @brief Switches the light mode palette to another position of the cockpit light mode switch
+     * @details Recolors the group slots in one pass, keeping their dimmer levels: all instrument, console, flood and
+     *          station lights of all panels change in the same frame. In manual and rainbow mode, the new colors are
+     *          applied with the next DCS-BIOS dimmer update after returning to normal mode.
+     * @param mode The switch position (0 = DAY, 1 = NITE, 2 = NVG)
+     * @see This method is called by onCockpitLightModeChange() in Board.h
+     */
+    void setLightMode(uint8_t mode) {
+        if (mode >= LIGHT_MODES || mode == lightMode) return;
+        lightMode = mode;
+        memcpy_P(&modeColors, &LIGHT_MODE_COLORS[mode], sizeof(LightModeColors));
+        if (currentMode != MODE_NORMAL) return;                       // Manual mode keeps its own colors
+        Palette* palette = Palette::getInstance();
+        palette->setGroupColor(Palette::SLOT_INSTR, modeColors.instr);
+        palette->setGroupColor(Palette::SLOT_CONSOLE, modeColors.console);
+        palette->setGroupColor(Palette::SLOT_FLOOD, modeColors.flood);
+        palette->setGroupColor(Palette::SLOT_STATION, modeColors.station);
     }
 
 
@@ -350,6 +881,16 @@ public:
     }
     DcsBios::IntegerBuffer floodDimmerBuffer{FA_18C_hornet_FLOOD_DIMMER, onFloodDimmerChange};
 
+    /**
+     * @brief Callback for cockpit light mode switch changes from DCS-BIOS
+     * @param newValue The new switch position from DCS-BIOS
+     * @see This method is called by DCS-BIOS when the cockpit light mode switch changes
+     */
+    static void onCockpitLightModeChange(unsigned int newValue) {
+        if (instance) instance->setLightMode(newValue);
+    }
+    DcsBios::IntegerBuffer lightModeBuffer{FA_18C_hornet_COCKKPIT_LIGHT_MODE_SW, onCockpitLightModeChange};
+
 };
 
 
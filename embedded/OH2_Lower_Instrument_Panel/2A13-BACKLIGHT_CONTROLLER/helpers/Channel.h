@@ -15,13 +15,21 @@
  * @version   t 0.3.2
  * @copyright Copyright 2016-2025 OpenHornet. See 2A13-BACKLIGHT_CONTROLLER.ino for details.
  * @brief     Channels are the logical representation of LED strips.
- * @details   Each channel maintains an array of LEDs, and a pointer to the first panel on the channel.
+ * @details   Each channel maintains an array of LEDs, and a fixed-size array of pointers to the panels on the channel.
  *            The channel class provides methods to add panels to the channel and to update the backlights of all 
- *            panels in the channel. The channel class does not hold an array of panels. Instead, panels are organized 
- *            in a linked list within each channel. This conserves stack memory. This approach avoids allocating 
- *            fixed-size arrays for panels in each channel, which would exhaust the limited stack space on the 
- *            Arduino Mega 2560 (I tested it). Instead, this class provides a pointer to its first panel.
- *            Thus,the channels are still able to iterate through all of their panels.
+ *            panels in the channel. The panel array is contiguous and lives in the channel object itself (static
+ *            storage, as channels are globals in the .ino), so adding a panel is O(1) and iterating the panels is
+ *            a plain loop over adjacent pointers. MAX_PANELS is sized to the busiest channel (7 panels on LC_1).
+ *            Each channel keeps its own dirty flag. It is set by the channel's panels only when a color in the 
+ *            channel's LED array actually changes, so that the board can output only the channels that changed.
+ *            The LED array holds one palette slot index per LED (see Palette.h). All channels share one CRGB output
+ *            buffer, sized to the largest channel, into which a channel expands its LEDs just before output.
+ *            Each channel has its own power budget, as each strip has its own power injection. A channel over its
+ *            budget is dimmed on its own at output, from the palette's power estimate for the channel. The budget
+ *            of the whole PSU is kept by the board on top of it.
+ *            LED ranges whose hardware differs from the rest of the strip, e.g. LEDs with another color order, are
+ *            declared as color segments on the channel. Their color order and color correction are applied to the
+ *            output buffer just before output, so that panels and the palette only ever deal with canonical colors.
  *********************************************************************************************************************/
 
 #ifndef __CHANNEL_H
@@ -30,35 +38,105 @@
 #include "FastLED.h"
 #include "Panel.h"
 #include "Colors.h"
+#include "LedUpdateState.h"
+#include "Palette.h"
 
 
 class Channel {
 
+public:
+    static const uint8_t MAX_PANELS = 8;                              // Maximum number of panels per channel
+    static const uint8_t MAX_SEGMENTS = 4;                            // Maximum number of color segments per channel
+    static const EOrder STRIP_ORDER = GRB;                            // Color order of the WS2812B strips
+
 private:
     uint8_t pin;           // Hardware pin number
     const char* pcbName;   // Changed from char* to const char*
     uint16_t ledCount;     // Number of LEDs
-    CRGB* leds;            // Pointer to LED array
+    uint8_t* leds;         // Pointer to LED array (palette slot indices)
     uint16_t currentIndex; // Index of the next available LED
-    Panel* firstPanel;     // Pointer to first panel in the channel
+    Panel* panels[MAX_PANELS]; // Panels in the channel, in strip order
     uint8_t panelCount;    // Number of panels in the channel
+    bool dirty;            // True if the LED array changed since the last output
+    CLEDController* controller; // FastLED controller that outputs this channel
+    uint8_t id;            // Channel id in the palette
+    uint32_t maxPower_mW;  // Power budget of the channel (0 = unlimited)
+    uint8_t segmentCount;  // Number of color segments in the channel
+
+    /**
+     * @brief An LED range with its own color order and color correction
+     */
+    struct ColorSegment {
+        uint16_t start;                                               // First LED of the range
+        uint16_t count;                                               // Number of LEDs in the range
+        uint8_t source[3];                                            // Canonical channel sent as output r, g and b
+        CRGB correction;                                              // Scale per canonical channel (255 = unchanged)
+    };
+    ColorSegment segments[MAX_SEGMENTS];                              // Color segments, applied by applySegments()
+    static CRGB* outputBuffer;      // Output buffer shared by all channels
+    static uint16_t outputCapacity; // Number of LEDs in the output buffer
+
+    /**
+     * @brief Halts execution and indicates a configuration error with a blinking built-in LED
+     */
+    static void haltWithError() {
+        while(1) {
+            digitalWrite(LED_BUILTIN, HIGH);
+            delay(100);
+            digitalWrite(LED_BUILTIN, LOW);
+            delay(100);
+        }
+    }
+
+    /**
+     * @brief Applies the color order and correction of the color segments to the expanded output buffer
+     * @see This method is called by show()
+     */
+    void applySegments() {
+        for (uint8_t s = 0; s < segmentCount; s++) {
+            const ColorSegment& segment = segments[s];
+            CRGB* out = outputBuffer + segment.start;
+            for (uint16_t i = 0; i < segment.count; i++) {
+                CRGB c = out[i];
+                c.r = scale8(c.r, segment.correction.r);
+                c.g = scale8(c.g, segment.correction.g);
+                c.b = scale8(c.b, segment.correction.b);
+                out[i] = CRGB(c[segment.source[0]], c[segment.source[1]], c[segment.source[2]]);
+            }
+        }
+    }
     
 public:
     /**
      * @brief Constructor for the Channel class
      * @param p Pin number for the LED strip
      * @param pcb Name of the PCB this channel is connected to
-     * @param ledArray Pointer to the LED array
+     * @param ledArray Pointer to the LED array (one palette slot index per LED)
      * @param count Number of LEDs in the strip
      */
-    Channel(uint8_t p, const char* pcb, CRGB* ledArray, uint16_t count) {
+    Channel(uint8_t p, const char* pcb, uint8_t* ledArray, uint16_t count) {
         pin = p;
         pcbName = pcb;
         leds = ledArray;   // Store pointer to the static array
         ledCount = count;
         currentIndex = 0;  // Initialize currentIndex to 0
-        firstPanel = nullptr;  // Initialize first panel pointer
         panelCount = 0;    // Initialize panel count
+        dirty = false;
+        controller = nullptr;
+        id = 0;
+        maxPower_mW = 0;
+        segmentCount = 0;
+    }
+
+    /**
+     * @brief Sets the CRGB output buffer shared by all channels
+     * @param buffer Pointer to the output buffer
+     * @param capacity Number of LEDs in the buffer; must be at least the LED count of the largest channel
+     * @see This method is called by setup() in 2A13-BACKLIGHT_CONTROLLER.ino, before initializing the channels
+     */
+    static void setOutputBuffer(CRGB* buffer, uint16_t capacity) {
+        outputBuffer = buffer;
+        outputCapacity = capacity;
     }
 
     /**
@@ -66,26 +144,42 @@ public:
      * @see This method is called during setup in 2A13-BACKLIGHT_CONTROLLER.ino
      */
     void initialize() {
+        if (!outputBuffer || ledCount > outputCapacity) haltWithError();  // Output buffer missing or too small
+
         // Use a switch statement to overcome strange behaviour of FastLED to have a pin number at compile time
         switch(pin) {
-            case 4:  FastLED.addLeds<WS2812B, 4, GRB>(leds, ledCount); break;
-            case 5:  FastLED.addLeds<WS2812B, 5, GRB>(leds, ledCount); break;
-            case 6:  FastLED.addLeds<WS2812B, 6, GRB>(leds, ledCount); break;
-            case 7:  FastLED.addLeds<WS2812B, 7, GRB>(leds, ledCount); break;
-            case 8:  FastLED.addLeds<WS2812B, 8, GRB>(leds, ledCount); break;
-            case 9:  FastLED.addLeds<WS2812B, 9, GRB>(leds, ledCount); break;
-            case 10: FastLED.addLeds<WS2812B, 10, GRB>(leds, ledCount); break;
-            case 11: FastLED.addLeds<WS2812B, 11, GRB>(leds, ledCount); break;
-            case 12: FastLED.addLeds<WS2812B, 12, GRB>(leds, ledCount); break;
-            case 13: FastLED.addLeds<WS2812B, 13, GRB>(leds, ledCount); break;
+            case 4:  controller = &FastLED.addLeds<WS2812B, 4, STRIP_ORDER>(outputBuffer, ledCount); break;
+            case 5:  controller = &FastLED.addLeds<WS2812B, 5, STRIP_ORDER>(outputBuffer, ledCount); break;
+            case 6:  controller = &FastLED.addLeds<WS2812B, 6, STRIP_ORDER>(outputBuffer, ledCount); break;
+            case 7:  controller = &FastLED.addLeds<WS2812B, 7, STRIP_ORDER>(outputBuffer, ledCount); break;
+            case 8:  controller = &FastLED.addLeds<WS2812B, 8, STRIP_ORDER>(outputBuffer, ledCount); break;
+            case 9:  controller = &FastLED.addLeds<WS2812B, 9, STRIP_ORDER>(outputBuffer, ledCount); break;
+            case 10: controller = &FastLED.addLeds<WS2812B, 10, STRIP_ORDER>(outputBuffer, ledCount); break;
+            case 11: controller = &FastLED.addLeds<WS2812B, 11, STRIP_ORDER>(outputBuffer, ledCount); break;
+            case 12: controller = &FastLED.addLeds<WS2812B, 12, STRIP_ORDER>(outputBuffer, ledCount); break;
+            case 13: controller = &FastLED.addLeds<WS2812B, 13, STRIP_ORDER>(outputBuffer, ledCount); break;
             default: break; // Handle invalid pin
         }
         
-        fill_solid(leds, ledCount, NVIS_BLACK);
+        memset(leds, Palette::SLOT_BLACK, ledCount);
+        id = Palette::getInstance()->registerChannel(&dirty);
+        dirty = true;
     }
 
     /**
-     * @brief Adds a panel to the channel's linked list
+     * @brief Sets the power budget of the channel
+     * @details Use the rated current of the channel's power injection (connector and wiring), not a share of the
+     *          PSU: the PSU limit is applied to all channels together by Board::setMaxPower().
+     * @param volts Supply voltage
+     * @param milliamps Maximum current of the channel's power injection
+     * @see This method is called by setup() in 2A13-BACKLIGHT_CONTROLLER.ino
+     */
+    void setMaxPower(uint8_t volts, uint32_t milliamps) {
+        maxPower_mW = (uint32_t)volts * milliamps;
+    }
+
+    /**
+     * @brief Appends a panel to the channel's panel array
      * @tparam PanelType The type of panel to add
      * @see This method is called by setup() in 2A13-BACKLIGHT_CONTROLLER.ino
      */
@@ -93,33 +187,58 @@ public:
     void addPanel() {
         PanelType* panel = PanelType::getInstance(currentIndex, leds);
         
-        // Safety check: Ensure we don't exceed the channel's LED capacity
-        if (currentIndex + panel->getLedCount() > ledCount) {
-            // Halt execution and indicate error with LED pattern
-            while(1) {
-                digitalWrite(LED_BUILTIN, HIGH);
-                delay(100);
-                digitalWrite(LED_BUILTIN, LOW);
-                delay(100);
-            }
+        // Safety check: Ensure we don't exceed the channel's LED capacity or panel array
+        if (currentIndex + panel->getLedCount() > ledCount || panelCount >= MAX_PANELS) {
+            haltWithError();                                          // Halt execution and indicate error with LED pattern
         }
+        if (!panel->indexRoles()) haltWithError();                    // Panel::MAX_INDEXED_RUNS or _ROLES too small
         
-        // Add panel to linked list
-        if (firstPanel == nullptr) {
-            firstPanel = panel;  // First panel in the channel
-        } else {
-            // Find the last panel
-            Panel* currentPanel = firstPanel;
-            while (currentPanel->nextPanel != nullptr) {
-                currentPanel = currentPanel->nextPanel;
-            }
-            currentPanel->nextPanel = panel;  // Add new panel at the end
-        }
-        
-        panelCount++;
+        panels[panelCount++] = panel;                                 // Add panel at the end
+        panel->channelDirty = &dirty;                                 // Let the panel flag changes on this channel
+        panel->channelId = id;
         currentIndex += panel->getLedCount();
     }
 
+    /**
+     * @brief Appends a panel whose LEDs differ from the strip, and declares its LEDs as a color segment
+     * @tparam PanelType The type of panel to add
+     * @param ledOrder Color order of the panel's LEDs
+     * @param correction Color correction of the panel's LEDs (255 per channel = none)
+     * @see This method is called by setup() in 2A13-BACKLIGHT_CONTROLLER.ino
+     */
+    template<typename PanelType>
+    void addPanel(EOrder ledOrder, const CRGB& correction = CRGB(255, 255, 255)) {
+        uint16_t start = currentIndex;
+        addPanel<PanelType>();
+        addColorSegment(start, currentIndex - start, ledOrder, correction);
+    }
+
+    /**
+     * @brief Declares a range of LEDs with another color order or a color correction
+     * @details The strip sends the channels of each LED in STRIP_ORDER, and an LED reads them in its own order. For
+     *          the LED to show the canonical color, the segment's LEDs are reordered in the output buffer: output
+     *          channel STRIP_ORDER[i] carries canonical channel ledOrder[i]. The permutation is worked out here once.
+     * @param start First LED of the range on the channel
+     * @param count Number of LEDs in the range
+     * @param ledOrder Color order of the LEDs in the range
+     * @param correction Color correction of the LEDs in the range (255 per channel = none)
+     * @see This method is called by addPanel() or by setup() in 2A13-BACKLIGHT_CONTROLLER.ino
+     */
+    void addColorSegment(uint16_t start, uint16_t count, EOrder ledOrder, const CRGB& correction = CRGB(255, 255, 255)) {
+        if (start + count > ledCount || segmentCount >= MAX_SEGMENTS) {
+            haltWithError();                                          // Halt execution and indicate error with LED pattern
+        }
+        ColorSegment& segment = segments[segmentCount++];
+        segment.start = start;
+        segment.count = count;
+        for (uint8_t i = 0; i < 3; i++) {                             // EOrder holds one octal digit per wire position
+            uint8_t shift = 3 * (2 - i);
+            segment.source[(STRIP_ORDER >> shift) & 3] = (ledOrder >> shift) & 3;
+        }
+        segment.correction = correction;
+        dirty = true;
+    }
+
     // Getters
     /**
      * @brief Gets the pin number for this channel
@@ -141,15 +260,16 @@ public:
 
     /**
      * @brief Gets the LED array for this channel
-     * @return Pointer to the LED array
+     * @return Pointer to the LED array (palette slot indices)
      */
-    CRGB* getLeds() const { return leds; }
+    uint8_t* getLeds() const { return leds; }
 
     /**
-     * @brief Gets the first panel in the channel's linked list
-     * @return Pointer to the first panel
+     * @brief Gets a panel of the channel
+     * @param i Position of the panel on the strip, 0 to getPanelCount() - 1
+     * @return Pointer to the panel
      */
-    Panel* getFirstPanel() const { return firstPanel; }
+    Panel* getPanel(uint8_t i) const { return panels[i]; }
 
     /**
      * @brief Gets the number of panels in this channel
@@ -157,6 +277,67 @@ public:
      */
     uint8_t getPanelCount() const { return panelCount; }
 
+    /**
+     * @brief Checks whether the LED array changed since the last output
+     * @return True if the channel needs to be output
+     */
+    bool isDirty() const { return dirty; }
+
+    /**
+     * @brief Marks the channel for output, e.g. after writing its LED array directly
+     * @see This method is called by Board::processMode() in rainbow mode
+     */
+    void markDirty() { dirty = true; }
+
+    /**
+     * @brief Gets the estimated power drawn by the channel's LEDs at full brightness
+     * @return Estimated power in milliwatts
+     * @see This method is called by Board::startFrame()
+     */
+    uint32_t getPower_mW() const { return Palette::getInstance()->getChannelPower_mW(id, ledCount); }
+
+    /**
+     * @brief Expands this channel's LED array into the output buffer, outputs it and clears the dirty flag
+     * @details If the channel would exceed its power budget, its brightness is reduced for this output. A change of
+     *          the estimate always comes with a change of the channel's LEDs, so the channel is dirty then anyway.
+     * @param brightness Global brightness scale applied during output
+     * @see This method is called by Board::updateLeds()
+     */
+    void show(uint8_t brightness) {
+        if (controller) {
+            Palette* palette = Palette::getInstance();
+            if (maxPower_mW > 0) {                                    // Same power model as FastLED, per channel
+                uint32_t required_mW = getPower_mW() * brightness / 256;
+                if (required_mW > maxPower_mW) brightness = (uint32_t)brightness * maxPower_mW / required_mW;
+            }
+            palette->expand(leds, outputBuffer, ledCount);
+            applySegments();
+            controller->showLeds(brightness);
+        }
+        dirty = false;
+    }
+
+    /**
+     * @brief Points the LEDs to the rainbow slots, so that rotating the slot hues moves a rainbow along the strip
+     * @param deltaHue Hue change between two neighbouring LEDs
+     * @see This method is called by Board::processMode() when entering rainbow mode
+     */
+    void fillRainbow(uint8_t deltaHue) {
+        Palette* palette = Palette::getInstance();
+        bool changed = false;
+        for (uint8_t i = 0; i < panelCount; i++) {
+            panels[i]->filledGroups = 0;                              // The dimmer setters must fill their roles again
+        }
+        for (uint16_t i = 0; i < ledCount; i++) {
+            uint8_t hue = i * deltaHue;                               // Hue offset of this LED, wraps like the color wheel
+            changed |= palette->assign(&leds[i], 1, Palette::SLOT_RAINBOW + hue / (256 / Palette::RAINBOW_SLOTS), id);
+        }
+        if (changed) {
+            dirty = true;
+            LedUpdateState::getInstance()->setUpdateFlag(true);
+        }
+    }
+
     /**
      * @brief Updates backlights for all panels in this channel
      * @param brightness The brightness value to set
@@ -164,10 +345,8 @@ public:
      * @see This method is called by Board::fillSolid() and Board::updateInstrumentLights()
      */
     void updateInstrLights(uint16_t brightness, const CRGB& color = NVIS_GREEN_A) {
-        Panel* current = firstPanel;
-        while (current != nullptr) {
-            current->setInstrLights(brightness, color);
-            current = current->nextPanel;
+        for (uint8_t i = 0; i < panelCount; i++) {
+            panels[i]->setInstrLights(brightness, color);
         }
     }
 
@@ -178,24 +357,62 @@ public:
      * @see This method is called by Board::updateConsoleLights() 
      */
     void updateConsoleLights(uint16_t brightness, const CRGB& color = NVIS_GREEN_A) {
-        Panel* current = firstPanel;
-        while (current != nullptr) {
-            current->setConsoleLights(brightness, color);
-            current = current->nextPanel;
+        for (uint8_t i = 0; i < panelCount; i++) {
+            panels[i]->setConsoleLights(brightness, color);
         }
     }
 
     /**
      * @brief Updates flood lights for all panels in this channel
      * @param brightness The brightness value to set
+     * @param color The color to set (defaults to NVIS_WHITE)
      * @see This method is called by Board::updateFloodLights() 
      */
-    void updateFloodLights(uint16_t brightness) {
-        Panel* current = firstPanel;
-        while (current != nullptr) {
-            current->setFloodlights(brightness);
-            current = current->nextPanel;
+    void updateFloodLights(uint16_t brightness, const CRGB& color = NVIS_WHITE) {
+        for (uint8_t i = 0; i < panelCount; i++) {
+            panels[i]->setFloodlights(brightness, color);
+        }
+    }
+
+    /**
+     * @brief Gets the number of LED runs of all panels in this channel, i.e. the size of its snapshot
+     * @return The run count
+     */
+    uint16_t getRunCount() const {
+        uint16_t runs = 0;
+        for (uint8_t i = 0; i < panelCount; i++) {
+            runs += panels[i]->getRunCount();
+        }
+        return runs;
+    }
+
+    /**
+     * @brief Writes the palette slot of every LED run of this channel's panels to a snapshot
+     * @param out Snapshot buffer, at least getRunCount() bytes
+     * @return Pointer behind the bytes written
+     * @see This method is called by Board::takeSnapshot()
+     */
+    uint8_t* saveSnapshot(uint8_t* out) const {
+        for (uint8_t i = 0; i < panelCount; i++) {
+            out = panels[i]->saveSnapshot(out);
+        }
+        return out;
+    }
+
+    /**
+     * @brief Sets the LEDs of this channel's panels back to a snapshot
+     * @param in Snapshot data written by saveSnapshot()
+     * @param instr Instrument dimmer value at the time of the snapshot
+     * @param console Console dimmer value at the time of the snapshot
+     * @param flood Flood dimmer value at the time of the snapshot
+     * @return Pointer behind the bytes read
+     * @see This method is called by Board::restoreSnapshot()
+     */
+    const uint8_t* restoreSnapshot(const uint8_t* in, uint16_t instr, uint16_t console, uint16_t flood) {
+        for (uint8_t i = 0; i < panelCount; i++) {
+            in = panels[i]->restoreSnapshot(in, instr, console, flood);
         }
+        return in;
     }
 
     /**
@@ -204,16 +421,21 @@ public:
      */
     void setAllLightsOff() {
         // Clear all LEDs in the entire channel array (not just panel-tracked ones)
-        fill_solid(leds, ledCount, NVIS_BLACK);
+        if (Palette::getInstance()->assign(leds, ledCount, Palette::SLOT_BLACK, id)) {
+            dirty = true;
+            LedUpdateState::getInstance()->setUpdateFlag(true);
+        }
         
         // Also clear panel-tracked LEDs and reset brightness state
-        Panel* current = firstPanel;
-        while (current != nullptr) {
-            current->setAllLightsOff();
-            current = current->nextPanel;
+        for (uint8_t i = 0; i < panelCount; i++) {
+            panels[i]->setAllLightsOff();
         }
     }
 
 };
 
+// Initialize static output buffer
+CRGB* Channel::outputBuffer = nullptr;
+uint16_t Channel::outputCapacity = 0;
+
 #endif 
\ No newline at end of file
@@ -0,0 +1,76 @@
+/**********************************************************************************************************************
+ *        ____                   _    _                       _
+ *       / __ \                 | |  | |                     | |
+ *      | |  | |_ __   ___ _ __ | |__| | ___  _ __ _ __   ___| |_
+ *      | |  | | '_ \ / _ \ '_ \|  __  |/ _ \| '__| '_ \ / _ \ __|
+ *      | |__| | |_) |  __/ | | | |  | | (_) | |  | | | |  __/ |_
+ *       \____/| .__/ \___|_| |_|_|  |_|\___/|_|  |_| |_|\___|\__|
+ *             | |
+ *             |_|
+ *   ----------------------------------------------------------------------------------
+ *
+ * @file      Gamma.h
+ * @author    Ulukaii
+ * @date      17.10.2026
+ * @version   t 0.4.0
+ * @copyright Copyright 2016-2026 OpenHornet. See 2A13-BACKLIGHT_CONTROLLER.ino for details.
+ * @brief     Perceptual dimming curve from the 16-bit DCS-BIOS dimmer values to an LED scale.
+ * @details   The dimmer value is read as perceived lightness (CIE 1976 L*, 0-100) and converted to the relative
+ *            luminance the LEDs have to emit. A linear map to 0-255 puts most of the knob travel into brightness
+ *            levels that look alike, and leaves only a few coarse steps at NVG brightness.
+ *            The scale is an 8.8 fixed point value (0 - 255.0): the integer part is the nscale8_video() scale, the
+ *            fraction is used for temporal dithering (see Palette::setGroupLevel()).
+ *            The table holds one entry per 256 dimmer steps; values in between are interpolated, which costs one
+ *            multiplication and no division, unlike map().
+ *********************************************************************************************************************/
+
+#ifndef __GAMMA_H
+#define __GAMMA_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Scale (8.8 fixed point) for the dimmer values k * 256, k = 0..256
+ * @details Generated with L = min(100, 100 * k * 256 / 65535) and Y = (L <= 8) ? L / 903.3 : ((L + 16) / 116)^3,
+ *          scale = round(Y * 255 * 256). Entry 256 stands for the (virtual) dimmer value 65536.
+ */
+const uint16_t GAMMA_SCALE[257] PROGMEM = {
+        0,    28,    56,    85,   113,   141,   169,   198,   226,   254,   282,   311,
+      339,   367,   395,   423,   452,   480,   508,   536,   565,   593,   622,   652,
+      683,   715,   748,   782,   817,   854,   891,   929,   968,  1009,  1050,  1093,
+     1136,  1181,  1227,  1274,  1323,  1372,  1423,  1475,  1529,  1583,  1639,  1696,
+     1755,  1815,  1876,  1939,  2003,  2068,  2135,  2203,  2272,  2343,  2416,  2490,
+     2565,  2642,  2721,  2801,  2883,  2966,  3050,  3137,  3225,  3314,  3406,  3499,
+     3593,  3689,  3787,  3887,  3989,  4092,  4197,  4303,  4412,  4522,  4634,  4748,
+     4864,  4982,  5102,  5223,  5346,  5472,  5599,  5728,  5860,  5993,  6128,  6265,
+     6404,  6546,  6689,  6835,  6982,  7132,  7284,  7437,  7594,  7752,  7912,  8075,
+     8240,  8407,  8576,  8748,  8921,  9098,  9276,  9457,  9640,  9825, 10013, 10203,
+    10396, 10591, 10788, 10988, 11190, 11395, 11602, 11812, 12024, 12239, 12456, 12676,
+    12898, 13124, 13351, 13581, 13814, 14050, 14288, 14529, 14772, 15019, 15268, 15519,
+    15774, 16031, 16291, 16554, 16819, 17088, 17359, 17633, 17910, 18190, 18473, 18759,
+    19047, 19339, 19634, 19931, 20232, 20535, 20842, 21151, 21464, 21780, 22098, 22420,
+    22745, 23073, 23405, 23739, 24077, 24417, 24761, 25109, 25459, 25813, 26170, 26530,
+    26893, 27260, 27630, 28004, 28380, 28761, 29144, 29531, 29921, 30315, 30712, 31113,
+    31517, 31925, 32336, 32750, 33169, 33590, 34016, 34444, 34877, 35313, 35753, 36196,
+    36643, 37093, 37548, 38006, 38467, 38933, 39402, 39875, 40351, 40832, 41316, 41804,
+    42296, 42792, 43291, 43795, 44302, 44813, 45329, 45848, 46371, 46898, 47429, 47964,
+    48503, 49046, 49593, 50144, 50699, 51258, 51822, 52389, 52961, 53537, 54116, 54700,
+    55289, 55881, 56478, 57079, 57684, 58293, 58907, 59525, 60147, 60774, 61405, 62040,
+    62680, 63324, 63972, 64625, 65280
+};
+
+/**
+ * @brief Converts a DCS-BIOS dimmer value to a perceptually even LED scale
+ * @param dimmer The dimmer value (0-65535)
+ * @return The scale in 8.8 fixed point (0 - 255.0)
+ * @see This function is called by Panel::setInstrLights() and the other group light methods
+ */
+inline uint16_t dimmerToScale(uint16_t dimmer) {
+    uint8_t k = dimmer >> 8;
+    uint8_t fraction = dimmer & 0xff;
+    uint16_t low = pgm_read_word(&GAMMA_SCALE[k]);
+    uint16_t high = pgm_read_word(&GAMMA_SCALE[k + 1]);
+    return low + (uint16_t)(((uint32_t)(high - low) * fraction) >> 8);  // No division, unlike map()
+}
+
+#endif
@@ -0,0 +1,189 @@
+/**********************************************************************************************************************
+ *        ____                   _    _                       _
+ *       / __ \                 | |  | |                     | |
+ *      | |  | |_ __   ___ _ __ | |__| | ___  _ __ _ __   ___| |_
+ *      | |  | | '_ \ / _ \ '_ \|  __  |/ _ \| '__| '_ \ / _ \ __|
+ *      | |__| | |_) |  __/ | | | |  | | (_) | |  | | | |  __/ |_
+ *       \____/| .__/ \___|_| |_|_|  |_|\___/|_|  |_| |_|\___|\__|
+ *             | |
+ *             |_|
+ *   ----------------------------------------------------------------------------------
+ *
+ * @file      InputEvents.h
+ * @author    Ulukaii
+ * @date      17.10.2026
+ * @version   t 0.4.0
+ * @copyright Copyright 2016-2026 OpenHornet. See 2A13-BACKLIGHT_CONTROLLER.ino for details.
+ * @brief     Interrupt-driven rotary encoder and encoder switch, delivered to the board as a queue of events.
+ * @details   The encoder (pins 22/23) and its switch (pin 24) are sampled once per millisecond in the Timer0
+ *            compare B interrupt, so that no detent is lost while loop() is busy, e.g. during a long strip output
+ *            (FastLED serves interrupts between LEDs). On the Mega 2560, these pins (port A) have no pin change
+ *            interrupts, so a timer is used instead; Timer0 already runs for millis(), its compare B interrupt is
+ *            free and fires once per overflow (1.024 ms).
+ *            The interrupt decodes the quadrature signal like the RotaryEncoder library in TWO03 latch mode (one
+ *            detent per two steps, latched at the states 0 and 3) and debounces the switch (stable for 10 samples).
+ *            Events are written to a single-producer single-consumer ring buffer: the interrupt only writes the
+ *            head, Board only writes the tail, and both are single bytes, so no locking is needed.
+ * @remark    Technical implementation: singleton, like Board. The pins are read through their port registers
+ *            (a few cycles instead of digitalRead()).
+ *********************************************************************************************************************/
+
+#ifndef __INPUT_EVENTS_H
+#define __INPUT_EVENTS_H
+
+#include <Arduino.h>
+
+class InputEvents {
+public:
+    enum Event : uint8_t {
+        CLOCKWISE,                                                    // Encoder turned one detent clockwise
+        COUNTERCLOCKWISE,                                             // Encoder turned one detent counterclockwise
+        PRESS,                                                        // Switch pressed (debounced)
+        RELEASE                                                       // Switch released (debounced)
+    };
+
+    /**
+     * @brief Gets the singleton instance of the InputEvents class
+     * @return Pointer to the singleton instance
+     */
+    static InputEvents* getInstance() {
+        if (!instance) {
+            static InputEvents events;
+            instance = &events;                                       // Static storage, no heap allocation
+        }
+        return instance;
+    }
+
+    /**
+     * @brief Configures the pins and starts sampling them in the Timer0 compare B interrupt
+     * @param swPin Pin number for the encoder switch
+     * @param aPin Pin number for encoder A
+     * @param bPin Pin number for encoder B
+     * @see This method is called by Board::setupRotaryEncoder()
+     */
+    void begin(uint8_t swPin, uint8_t aPin, uint8_t bPin) {
+        pinMode(swPin, INPUT_PULLUP);
+        pinMode(aPin, INPUT_PULLUP);
+        pinMode(bPin, INPUT_PULLUP);
+        swReg = portInputRegister(digitalPinToPort(swPin));
+        aReg = portInputRegister(digitalPinToPort(aPin));
+        bReg = portInputRegister(digitalPinToPort(bPin));
+        swMask = digitalPinToBitMask(swPin);
+        aMask = digitalPinToBitMask(aPin);
+        bMask = digitalPinToBitMask(bPin);
+        knobState = readKnob();
+        swState = (*swReg & swMask) != 0;
+#ifdef OCIE0B
+        OCR0B = 0x80;                                                 // Halfway between two millis() overflows
+        TIMSK0 |= _BV(OCIE0B);
+#endif
+    }
+
+    /**
+     * @brief Samples the pins once and queues the resulting events
+     * @see This method is called by the Timer0 compare B interrupt
+     */
+    void poll() {
+        uint8_t state = readKnob();
+        if (state != knobState) {
+            steps += KNOB_DIRECTION[state | (knobState << 2)];
+            knobState = state;
+            if (state == 0 || state == 3) {                           // Latch position of the detent
+                if (steps >= 2) push(CLOCKWISE);
+                else if (steps <= -2) push(COUNTERCLOCKWISE);
+                steps = 0;
+            }
+        }
+
+        bool sw = (*swReg & swMask) != 0;
+        if (sw == swState) {
+            swStableCount = 0;
+        } else if (++swStableCount >= DEBOUNCE_SAMPLES) {             // Changed level held long enough
+            swState = sw;
+            swStableCount = 0;
+            push(sw ? RELEASE : PRESS);                               // Active low: the switch pulls to ground
+        }
+    }
+
+    /**
+     * @brief Takes the oldest event from the queue
+     * @param event Receives the event
+     * @return True if an event was taken, false if the queue is empty
+     * @see This method is called by Board::handleModeChange()
+     */
+    bool pop(Event& event) {
+        uint8_t t = tail;
+        if (t == head) return false;
+        event = (Event)queue[t];
+        tail = (t + 1) & (QUEUE_SIZE - 1);                            // Publish the free slot after reading it
+        return true;
+    }
+
+    /**
+     * @brief Gets the number of events dropped because the queue was full
+     */
+    uint16_t getDroppedEvents() const { return dropped; }
+
+private:
+    static InputEvents* instance;
+    static const uint8_t QUEUE_SIZE = 16;                             // Power of two
+    static const uint8_t DEBOUNCE_SAMPLES = 10;                       // 10 ms at one sample per millisecond
+    static const int8_t KNOB_DIRECTION[16];                           // Step per (old state, new state), as in RotaryEncoder
+
+    volatile uint8_t queue[QUEUE_SIZE];                               // Ring buffer of events
+    volatile uint8_t head;                                            // Next slot to write (interrupt only)
+    volatile uint8_t tail;                                            // Next slot to read (Board only)
+    volatile uint16_t dropped;                                        // Events lost to a full queue
+    volatile uint8_t* swReg;                                          // Input registers and bit masks of the pins
+    volatile uint8_t* aReg;
+    volatile uint8_t* bReg;
+    uint8_t swMask;
+    uint8_t aMask;
+    uint8_t bMask;
+    uint8_t knobState;                                                // Last quadrature state (A = bit 0, B = bit 1)
+    int8_t steps;                                                     // Steps since the last latched detent
+    bool swState;                                                     // Debounced switch level
+    uint8_t swStableCount;                                            // Samples the switch differed from swState
+
+    /**
+     * @brief Private constructor to enforce singleton pattern
+     */
+    InputEvents() {
+        head = 0;
+        tail = 0;
+        dropped = 0;
+        swReg = aReg = bReg = nullptr;
+        swMask = aMask = bMask = 0;
+        knobState = 0;
+        steps = 0;
+        swState = HIGH;
+        swStableCount = 0;
+    }
+
+    uint8_t readKnob() const {
+        return ((*aReg & aMask) ? 1 : 0) | ((*bReg & bMask) ? 2 : 0);
+    }
+
+    void push(Event event) {
+        uint8_t h = head;
+        uint8_t next = (h + 1) & (QUEUE_SIZE - 1);
+        if (next == tail) {                                           // Full: the oldest events are kept
+            dropped++;
+            return;
+        }
+        queue[h] = event;
+        head = next;                                                  // Publish the event after writing it
+    }
+};
+
+// Initialize static members
+InputEvents* InputEvents::instance = nullptr;
+const int8_t InputEvents::KNOB_DIRECTION[16] = {0, -1, 1, 0, 1, 0, 0, -1, -1, 0, 0, 1, 0, 1, -1, 0};
+
+#ifdef TIMER0_COMPB_vect
+ISR(TIMER0_COMPB_vect) {                                              // Samples the encoder and switch every 1.024 ms
+    InputEvents::getInstance()->poll();
+}
+#endif
+
+#endif
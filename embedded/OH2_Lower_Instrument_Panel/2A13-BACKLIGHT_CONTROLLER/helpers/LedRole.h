@@ -15,9 +15,9 @@
  * @version   t 0.3.2
  * @copyright Copyright 2016-2025 OpenHornet. See 2A13-BACKLIGHT_CONTROLLER.ino for details.
  * @brief     Defines the role of the LEDs in the panels.
- * @details   Each panel holds a table of LEDs. These contain the role of the LED, which is one of the values
- *            defined in this enum. When LEDs update commands are processed, the table of LEDs is scanned through
- *            and only those LEDs that match the desired role are updated.
+ * @details   Each panel holds a table of LED runs. Each run contains the role of its LEDs, which is one of the values
+ *            defined in this enum. When LED update commands are processed, only the runs that match the desired role
+ *            are updated.
  *********************************************************************************************************************/
 
 #ifndef LED_ROLE_H
@@ -31,7 +31,6 @@
 enum LedRole {
     LED_INSTR_BL,
     LED_CONSOLE_BL,
-    LED_INSTR_BL_CGRB,
     LED_READY,
     LED_DISCH,
     LED_AG,
@@ -97,15 +96,11 @@ enum LedRole {
     LED_CSPARE3,
     // Jett Station Panel specific types
     LED_JETT_RO_1,
-    LED_JETT_RO_2,
     LED_JETT_RI_1,
-    LED_JETT_RI_2,
     LED_JETT_CTR_1,
-    LED_JETT_CTR_2,
     LED_JETT_LI_1,
-    LED_JETT_LI_2,
     LED_JETT_LO_1,
-    LED_JETT_LO_2,
+    LED_JETT_STATION_BL,
     LED_JETT_NOSE,
     LED_JETT_LEFT,
     LED_JETT_RIGHT,
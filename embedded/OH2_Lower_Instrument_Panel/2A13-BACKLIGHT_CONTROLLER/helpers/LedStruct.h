@@ -15,8 +15,10 @@
  * @version   t 0.3.2
  * @copyright Copyright 2016-2025 OpenHornet. See 2A13-BACKLIGHT_CONTROLLER.ino for details.
  * @brief     LED info structures.
- * @details   struct Led:     Bundles properties "index" and "role" of one LED.
+ * @details   struct LedRun:  Bundles a run of consecutive LEDs that share the same role ("start", "count", "role").
+ *            struct RoleRuns: Points from a role to the runs of that role in a panel's run index (see Panel.h).
  *            struct LedText: Bundles properties "index" and "text" of one LED.
+ *            ledRunsValid(): Compile-time check of a panel's run table, used in a static_assert next to each table.
  * @remark    LedText associates text with specific LEDs. This is intended for the PREFLT function.
  *            We use this in a separate struct because the 16 byte LED text is not always needed and we need to 
  *            save memory and access time. Putting both in the same struct could lead to memory problems.
@@ -26,18 +28,64 @@
 #define __LED_STRUCT_H
 
 #include <stdint.h>
+#include <stddef.h>
 #include "LedRole.h"
 
 // Maximum length for LED text description
 const int MAX_LEN = 16;                // Maximum length for legend text (including null terminator)
 
 
-struct Led {        
-    uint16_t index;               // Local position of the LED on the panel, starts at 0
-    LedRole  role;                // Role of LED as the enum defined above
+struct LedRun {
+    uint16_t start;               // Local position of the first LED of the run on the panel, starts at 0
+    uint16_t count;               // Number of consecutive LEDs in the run
+    uint8_t  role;                // Role shared by all LEDs of the run (LedRole, stored in one byte)
 };
 
 
+struct RoleRuns {
+    uint8_t  role;                // Role of the runs (LedRole, stored in one byte)
+    uint8_t  first;               // Position of the first run of the role in the panel's run index
+    uint8_t  count;               // Number of runs with this role
+};
+
+
+/**
+ * @brief Checks whether two runs share at least one LED
+ */
+constexpr bool ledRunsOverlap(const LedRun& a, const LedRun& b) {
+    return a.start < b.start + b.count && b.start < a.start + a.count;
+}
+
+/**
+ * @brief Checks run i against all runs after it, starting at run j
+ */
+constexpr bool ledRunValidFrom(const LedRun* runs, uint16_t n, uint16_t i, uint16_t j) {
+    return j >= n || (!ledRunsOverlap(runs[i], runs[j]) && ledRunValidFrom(runs, n, i, j + 1));
+}
+
+/**
+ * @brief Checks all runs from run i on: non-empty, within the panel, and not overlapping any later run
+ * @details Runs are compared pairwise, so the table does not need to be sorted by start index. Runs may be listed
+ *          in the order of the panel's sections (e.g. the Jett Station panel), not necessarily by position.
+ */
+constexpr bool ledRunsValid(const LedRun* runs, uint16_t n, uint16_t ledCount, uint16_t i = 0) {
+    return i >= n || (runs[i].count > 0 && runs[i].start + runs[i].count <= ledCount &&
+                      ledRunValidFrom(runs, n, i, i + 1) && ledRunsValid(runs, n, ledCount, i + 1));
+}
+
+/**
+ * @brief Checks a panel's run table at compile time
+ * @param runs The constexpr run table
+ * @param ledCount Number of LEDs on the panel
+ * @return True if no run is empty, exceeds ledCount or overlaps another run
+ * @see This function is used in a static_assert after each panel's run table
+ */
+template<size_t N>
+constexpr bool ledRunsValid(const LedRun (&runs)[N], uint16_t ledCount) {
+    return ledRunsValid(runs, N, ledCount);
+}
+
+
 struct LedText {        
     uint16_t index;               // Local position of the LED on the panel, starts at 0
     char     text[MAX_LEN];       // Free text to associate LED with legend text on a panel
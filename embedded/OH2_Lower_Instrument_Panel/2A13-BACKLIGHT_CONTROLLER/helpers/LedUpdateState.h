@@ -17,6 +17,7 @@
  * @brief     This class serves just one purpose: track whether the LEDs need to be updated.
  *            The flag can be set by any panel as it processes DCS-BIOS updates.
  *            Then, the flag is read by board.h in each loop and if TRUE, used to trigger the update of the LEDs.
+ *            It also records when the first change after an output happened, to measure the output latency.
  * @details   Technical implementation: singleton state machine and using interrupt pausing to ensure atomicity
  *            when writing the flag.
  *********************************************************************************************************************/
@@ -31,6 +32,7 @@ class LedUpdateState {
 private:
     static LedUpdateState* instance;
     volatile bool ledsNeedUpdate;                                     // volatile to prevent compiler optimization
+    volatile unsigned long firstChangeMicros;                         // Time when the flag was set after being clear
     
     /**
      * @brief Private constructor to enforce singleton pattern
@@ -38,6 +40,7 @@ private:
      */
     LedUpdateState() {                                                // Private constructor to enforce singleton pattern
         ledsNeedUpdate = false;
+        firstChangeMicros = 0;
     }
 
 public:
@@ -48,18 +51,22 @@ public:
      */
     static LedUpdateState* getInstance() {
         if (!instance) {
-            instance = new LedUpdateState();
+            static LedUpdateState state;
+            instance = &state;                                        // Static storage, no heap allocation
         }
         return instance;
     }
     
     /**
      * @brief Sets the LED update flag in an atomic operation
+     * @details Setting a cleared flag records the time of the first change, which the frame pacer in Board uses
+     *          to measure the change-to-photon latency.
      * @param requireUpdate The new state of the update flag
      * @see This method is called by Board methods that modify LED states
      */
     void setUpdateFlag(bool requireUpdate) {
         cli();                                                        // Disable interrupts (same as noInterrupts())
+        if (requireUpdate && !ledsNeedUpdate) firstChangeMicros = micros();
         ledsNeedUpdate = requireUpdate;
         sei();                                                        // Re-enable interrupts (same as interrupts())
     }
@@ -72,6 +79,18 @@ public:
     bool getUpdateFlag() const {
         return ledsNeedUpdate;
     }
+
+    /**
+     * @brief Gets the time of the first change since the flag was last cleared
+     * @return Timestamp in microseconds, only meaningful while the flag is set
+     * @see This method is called by Board::updateLeds() when a frame starts
+     */
+    unsigned long getFirstChangeMicros() const {
+        cli();
+        unsigned long t = firstChangeMicros;
+        sei();
+        return t;
+    }
 };
 
 // Initialize static instance pointer
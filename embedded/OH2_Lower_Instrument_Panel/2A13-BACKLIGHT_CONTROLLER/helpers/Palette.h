@@ -0,0 +1,443 @@
+/**********************************************************************************************************************
+ *        ____                   _    _                       _
+ *       / __ \                 | |  | |                     | |
+ *      | |  | |_ __   ___ _ __ | |__| | ___  _ __ _ __   ___| |_
+ *      | |  | | '_ \ / _ \ '_ \|  __  |/ _ \| '__| '_ \ / _ \ __|
+ *      | |__| | |_) |  __/ | | | |  | | (_) | |  | | | |  __/ |_
+ *       \____/| .__/ \___|_| |_|_|  |_|\___/|_|  |_| |_|\___|\__|
+ *             | |
+ *             |_|
+ *   ----------------------------------------------------------------------------------
+ *
+ * @file      Palette.h
+ * @author    Ulukaii
+ * @date      17.10.2026
+ * @version   t 0.4.0
+ * @copyright Copyright 2016-2026 OpenHornet. See 2A13-BACKLIGHT_CONTROLLER.ino for details.
+ * @brief     Color palette for the 1-byte-per-LED frame buffers of the channels.
+ * @details   Each LED of a channel stores a palette slot index instead of a CRGB value. The slots are:
+ *            - SLOT_BLACK:   LED off
+ *            - Group slots:  one slot each for instrument, console, flood and jettison station lights. The dimmers
+ *                            and the cockpit light mode change the slot's color, not the LEDs: a dimmer or light mode
+ *                            change is one palette write per group. The level of a group slot
+ *                            is an 8.8 fixed point scale (see Gamma.h). With BACKLIGHT_DITHERING defined, dither()
+ *                            alternates the slot between the two neighboring integer scales, so that on average the
+ *                            fraction is shown too; otherwise the scale is rounded. With a ramp time set, a new
+ *                            scale is approached linearly over that time by ramp(), instead of being applied at once.
+ *            - Rainbow slots: rotating hues for rainbow test mode 3
+ *            - Static slots: indicator colors, allocated once per distinct color by intern()
+ *            For each slot, the palette remembers which channels have used it, so that a slot color change marks
+ *            exactly those channels as dirty. The channel expands its indices to CRGB only when it is output.
+ *            The palette also keeps the power estimate of each channel up to date as LEDs change their slot: static
+ *            slots never change their color, so their power is summed per channel when LEDs are assigned; for the
+ *            group and rainbow slots, whose colors change, the number of LEDs per channel is counted instead.
+ * @remark    Technical implementation: singleton, like LedUpdateState.
+ *********************************************************************************************************************/
+
+#ifndef __PALETTE_H
+#define __PALETTE_H
+
+#include <Arduino.h>
+#include "FastLED.h"
+#include "Colors.h"
+#include "Gamma.h"
+#include "LedUpdateState.h"
+
+class Palette {
+public:
+    static const uint8_t SIZE = 48;                                   // Number of palette slots
+    static const uint8_t RAINBOW_SLOTS = 32;                          // Hues for rainbow mode, 8 hue steps apart
+    static const uint8_t MAX_CHANNELS = 16;                           // One bit per channel in the slot usage masks
+
+    enum Slot : uint8_t {
+        SLOT_BLACK = 0,                                               // LED off
+        SLOT_INSTR,                                                   // Instrument backlights
+        SLOT_CONSOLE,                                                 // Console backlights
+        SLOT_FLOOD,                                                   // Floodlights
+        SLOT_STATION,                                                 // Jettison station select lights
+        SLOT_GROUP_END,                                               // End of the group slots (dimmed by a scale)
+        SLOT_RAINBOW = SLOT_GROUP_END,                                // First of RAINBOW_SLOTS hues for rainbow mode
+        SLOT_STATIC = SLOT_RAINBOW + RAINBOW_SLOTS                    // First slot for interned indicator colors
+    };
+
+    static const uint8_t GROUP_SLOTS = SLOT_GROUP_END - SLOT_INSTR;   // Number of dimmable group slots
+
+    /**
+     * @brief Color and scale of all group slots, e.g. for a lighting snapshot
+     */
+    struct GroupState {
+        CRGB color[GROUP_SLOTS];
+        uint16_t scale[GROUP_SLOTS];
+    };
+
+    /**
+     * @brief Gets the singleton instance of the Palette class
+     * @return Pointer to the singleton instance
+     */
+    static Palette* getInstance() {
+        if (!instance) {
+            static Palette palette;
+            instance = &palette;                                      // Static storage, no heap allocation
+        }
+        return instance;
+    }
+
+    /**
+     * @brief Registers a channel's dirty flag, so that slot color changes can mark the channel
+     * @details The channel's LEDs start as SLOT_BLACK, see Channel::initialize().
+     * @param dirty Pointer to the channel's dirty flag
+     * @return The channel id used for assign()
+     * @see This method is called by Channel::initialize()
+     */
+    uint8_t registerChannel(bool* dirty) {
+        if (channelCount >= MAX_CHANNELS) return MAX_CHANNELS - 1;
+        channelDirty[channelCount] = dirty;
+        return channelCount++;
+    }
+
+    /**
+     * @brief Gets the slot of a static color, allocating a new slot for colors not seen before
+     * @details If all static slots are taken, the closest existing static color is used.
+     * @param color The indicator color
+     * @return The palette slot holding this color
+     * @see This method is called by Panel::setIndicatorColor()
+     */
+    uint8_t intern(const CRGB& color) {
+        if (color == colors[SLOT_BLACK]) return SLOT_BLACK;
+        for (uint8_t s = SLOT_STATIC; s < staticEnd; s++) {
+            if (colors[s] == color) return s;
+        }
+        if (staticEnd < SIZE) {
+            colors[staticEnd] = color;
+            slotPower[staticEnd] = powerOf(color);
+            return staticEnd++;
+        }
+        uint8_t best = SLOT_BLACK;                                    // Palette full: use the closest static color
+        uint16_t bestDistance = 0xffff;
+        for (uint8_t s = SLOT_STATIC; s < SIZE; s++) {
+            uint16_t d = abs(colors[s].r - color.r) + abs(colors[s].g - color.g) + abs(colors[s].b - color.b);
+            if (d < bestDistance) {
+                bestDistance = d;
+                best = s;
+            }
+        }
+        return best;
+    }
+
+    /**
+     * @brief Sets the color of a group or rainbow slot and marks all channels using it as dirty
+     * @param slot The slot to change
+     * @param color The new color
+     * @see This method is called by Panel::setInstrLights() and the other group light methods, and by Board
+     */
+    void setColor(uint8_t slot, const CRGB& color) {
+        if (colors[slot] == color) return;                            // No-op updates do not trigger an output
+        colors[slot] = color;
+        uint16_t power = powerOf(color);
+        if (slot >= SLOT_RAINBOW && slot < SLOT_STATIC) rainbowPower += (int32_t)power - slotPower[slot];
+        slotPower[slot] = power;
+        uint16_t users = slotUsers[slot];
+        if (!users) return;
+        for (uint8_t c = 0; c < channelCount; c++) {
+            if (users & (1U << c)) *channelDirty[c] = true;
+        }
+        LedUpdateState::getInstance()->setUpdateFlag(true);
+    }
+
+    /**
+     * @brief Sets a group slot to a color dimmed by a fractional scale
+     * @param slot The group slot (SLOT_INSTR to SLOT_STATION)
+     * @param color The undimmed color
+     * @param scale The scale in 8.8 fixed point, as returned by dimmerToScale()
+     * @see This method is called by Panel::setInstrLights() and the other group light methods
+     */
+    void setGroupLevel(uint8_t slot, const CRGB& color, uint16_t scale) {
+        uint8_t g = slot - SLOT_INSTR;
+        bool wasRamping = isRamping();                                // Sampled before this group's scale changes
+        groupColor[g] = color;
+        groupScale[g] = scale;
+        uint32_t target = (uint32_t)scale << 8;
+        if (!rampMs) {
+            groupLevel[g] = target;
+        } else if (groupLevel[g] != target) {
+            if (!wasRamping) lastRampMs = millis();                   // Ramp time starts with the first moving group
+            uint32_t distance = (groupLevel[g] > target) ? groupLevel[g] - target : target - groupLevel[g];
+            groupRate[g] = max((uint32_t)1, distance / rampMs);       // One division per change, not per frame
+        }
+        setColor(slot, groupShade(g));
+    }
+
+    /**
+     * @brief Changes the undimmed color of a group slot, keeping its scale and any ramp in progress
+     * @param slot The group slot (SLOT_INSTR to SLOT_STATION)
+     * @param color The new undimmed color
+     * @see This method is called by Board::setLightMode()
+     */
+    void setGroupColor(uint8_t slot, const CRGB& color) {
+        uint8_t g = slot - SLOT_INSTR;
+        if (groupColor[g] == color) return;
+        groupColor[g] = color;
+        setColor(slot, groupShade(g));
+    }
+
+    /**
+     * @brief Sets the time a group slot takes to reach a new scale
+     * @param ms Ramp time in milliseconds (0 = new scales are applied at once)
+     * @see This method is called by Board::setRampTime()
+     */
+    void setRampTime(uint16_t ms) { rampMs = ms; }
+
+    /**
+     * @brief Checks whether any group slot is still on its way to its scale
+     * @return True while a ramp is in progress
+     */
+    bool isRamping() const {
+        for (uint8_t g = 0; g < GROUP_SLOTS; g++) {
+            if (groupLevel[g] != ((uint32_t)groupScale[g] << 8)) return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Moves the group slots that are ramping toward their scales
+     * @details Only the moving groups are recomputed. Once all groups have reached their scales, the call costs
+     *          one comparison per group slot and causes no output.
+     * @param now Current time in milliseconds
+     * @return True if a group slot moved, i.e. a frame should be output
+     * @see This method is called by Board::updateLeds() once per frame interval
+     */
+    bool ramp(unsigned long now) {
+        unsigned long elapsed = now - lastRampMs;
+        lastRampMs = now;
+        bool moved = false;
+        for (uint8_t g = 0; g < GROUP_SLOTS; g++) {
+            uint32_t target = (uint32_t)groupScale[g] << 8;
+            uint32_t level = groupLevel[g];
+            if (level == target) continue;
+            uint32_t distance = (level > target) ? level - target : target - level;
+            uint32_t step = (elapsed >= rampMs) ? distance : min(distance, (uint32_t)(groupRate[g] * elapsed));
+            groupLevel[g] = (level > target) ? level - step : level + step;
+            setColor(SLOT_INSTR + g, groupShade(g));
+            moved = true;
+        }
+        return moved;
+    }
+
+    /**
+     * @brief Copies the color and scale of all group slots
+     * @param state Receives the group slot state
+     * @see This method is called by Board::takeSnapshot()
+     */
+    void saveGroups(GroupState& state) const {
+        for (uint8_t g = 0; g < GROUP_SLOTS; g++) {
+            state.color[g] = groupColor[g];
+            state.scale[g] = groupScale[g];
+        }
+    }
+
+    /**
+     * @brief Sets all group slots back to a saved state
+     * @param state The saved group slot state
+     * @see This method is called by Board::restoreSnapshot()
+     */
+    void restoreGroups(const GroupState& state) {
+        for (uint8_t g = 0; g < GROUP_SLOTS; g++) {
+            groupLevel[g] = (uint32_t)state.scale[g] << 8;            // No ramp: the pit comes back in one frame
+            setGroupLevel(SLOT_INSTR + g, state.color[g], state.scale[g]);
+        }
+    }
+
+#ifdef BACKLIGHT_DITHERING
+    /**
+     * @brief Advances the temporal dithering of the group slots by one frame
+     * @details Each group slot accumulates its scale fraction; a carry shows the next higher integer scale for one
+     *          frame. Only slots below DITHER_MAX_LEVEL with a fraction are dithered, where one integer step is a
+     *          visible change; all others do not change and cause no output.
+     * @return True if a slot color changed, i.e. a frame should be output
+     * @see This method is called by Board::updateLeds() once per dither period
+     */
+    bool dither() {
+        bool changed = false;
+        for (uint8_t g = 0; g < GROUP_SLOTS; g++) {
+            if (!(groupLevel[g] & 0xff00)) continue;                  // No fraction in the shown scale
+            if ((groupLevel[g] >> 16) >= DITHER_MAX_LEVEL) continue;  // Rounded by groupShade()
+            CRGB before = colors[SLOT_INSTR + g];
+            setColor(SLOT_INSTR + g, groupShade(g));
+            changed |= (before != colors[SLOT_INSTR + g]) && slotUsers[SLOT_INSTR + g];
+        }
+        return changed;
+    }
+#endif
+
+    /**
+     * @brief Gets the current color of a slot
+     * @param slot The slot
+     * @return The slot's color
+     */
+    const CRGB& getColor(uint8_t slot) const { return colors[slot]; }
+
+    /**
+     * @brief Sets LEDs to a slot, writing only those that differ, and records the slot's use by the channel
+     * @param leds Pointer to the first LED index to set
+     * @param count Number of LEDs to set
+     * @param slot The slot to set
+     * @param channelId The id of the channel the LEDs belong to
+     * @return True if at least one LED changed its slot
+     * @see This method is called by Panel and Channel for every LED index write
+     */
+    bool assign(uint8_t* leds, uint16_t count, uint8_t slot, uint8_t channelId) {
+        uint16_t written = 0;
+        uint16_t i = 0;
+        while (i < count) {                                           // One stretch of LEDs on the same slot at a time
+            uint8_t previous = leds[i];
+            uint16_t start = i;
+            while (i < count && leds[i] == previous) leds[i++] = slot;
+            if (previous == slot) continue;
+            account(channelId, previous, -(int16_t)(i - start));      // Accounted once per stretch, not per LED
+            written += i - start;
+        }
+        if (!written) return false;
+        account(channelId, slot, written);
+        slotUsers[slot] |= (1U << channelId);
+        return true;
+    }
+
+    /**
+     * @brief Expands a channel's slot indices into CRGB values for output
+     * @param leds Pointer to the channel's LED indices
+     * @param out Pointer to the output buffer, at least count LEDs long
+     * @param count Number of LEDs
+     * @see This method is called by Channel::show()
+     */
+    void expand(const uint8_t* leds, CRGB* out, uint16_t count) const {
+        for (uint16_t i = 0; i < count; i++) {
+            out[i] = colors[leds[i]];
+        }
+    }
+
+    /**
+     * @brief Estimates the power drawn by the LEDs of one channel at full brightness
+     * @details Same model as FastLED's calculate_max_brightness_for_power_mW(), but kept up to date by assign() and
+     *          setColor() instead of reading every LED for every output.
+     * @param channelId The id of the channel
+     * @param ledCount Number of LEDs of the channel
+     * @return Estimated power in milliwatts
+     * @see This method is called by Channel::show() when a power limit is set
+     */
+    uint32_t getChannelPower_mW(uint8_t channelId, uint16_t ledCount) const {
+        uint32_t power = staticPower[channelId];
+        for (uint8_t g = 0; g < GROUP_SLOTS; g++) {
+            power += (uint32_t)groupLedCount[channelId][g] * slotPower[SLOT_INSTR + g];
+        }
+        power += rainbowLedCount[channelId] * (rainbowPower / RAINBOW_SLOTS);  // Rainbow LEDs are spread over all hues
+        return (power >> 8) + (uint32_t)ledCount * DARK_mW;
+    }
+
+private:
+    static Palette* instance;
+    static const uint8_t RED_mW = 16 * 5;                             // 16 mA at 5 V for a full red channel
+    static const uint8_t GREEN_mW = 11 * 5;                           // 11 mA at 5 V for a full green channel
+    static const uint8_t BLUE_mW = 15 * 5;                            // 15 mA at 5 V for a full blue channel
+    static const uint8_t DARK_mW = 1 * 5;                             // 1 mA at 5 V for an LED that is off
+#ifdef BACKLIGHT_DITHERING
+    static const uint8_t DITHER_MAX_LEVEL = 32;                       // From this scale on, one step is below 3%: round
+#endif
+    CRGB colors[SIZE];                                                // Current color of each slot
+    uint16_t slotUsers[SIZE];                                         // Channels that have used the slot (bit mask)
+    uint16_t slotPower[SIZE];                                         // Power of each slot color in mW / 256
+    uint32_t staticPower[MAX_CHANNELS];                               // Power of the static slot LEDs per channel
+    uint16_t groupLedCount[MAX_CHANNELS][GROUP_SLOTS];                // LEDs per group slot and channel
+    uint16_t rainbowLedCount[MAX_CHANNELS];                           // LEDs on any rainbow slot per channel
+    uint32_t rainbowPower;                                            // Power of all rainbow slot colors together
+    bool* channelDirty[MAX_CHANNELS];                                 // Dirty flags of the registered channels
+    uint8_t channelCount;                                             // Number of registered channels
+    uint8_t staticEnd;                                                // Next free static slot
+    CRGB groupColor[GROUP_SLOTS];                                     // Undimmed color of each group slot
+    uint16_t groupScale[GROUP_SLOTS];                                 // Target scale of each group slot (8.8 fixed point)
+    uint32_t groupLevel[GROUP_SLOTS];                                 // Shown scale of each group slot (8.16 fixed point)
+    uint32_t groupRate[GROUP_SLOTS];                                  // Ramp step per millisecond (8.16 fixed point)
+    uint16_t rampMs;                                                  // Ramp time (0 = no ramp)
+    unsigned long lastRampMs;                                         // Time of the last ramp() step
+    uint8_t ditherError[GROUP_SLOTS];                                 // Accumulated scale fraction of each group slot
+
+    /**
+     * @brief Computes the power of a color at full brightness
+     * @param color The color
+     * @return Power in mW / 256
+     */
+    static uint16_t powerOf(const CRGB& color) {
+        return (uint16_t)color.r * RED_mW + (uint16_t)color.g * GREEN_mW + (uint16_t)color.b * BLUE_mW;
+    }
+
+    /**
+     * @brief Adds LEDs of a channel to a slot's power accounting, or removes them
+     * @param channelId The id of the channel
+     * @param slot The slot
+     * @param n Number of LEDs to add (negative to remove)
+     * @see This method is called by assign()
+     */
+    void account(uint8_t channelId, uint8_t slot, int16_t n) {
+        if (slot == SLOT_BLACK) return;                               // Dark LEDs are counted per channel
+        if (slot < SLOT_GROUP_END) groupLedCount[channelId][slot - SLOT_INSTR] += n;
+        else if (slot < SLOT_STATIC) rainbowLedCount[channelId] += n;
+        else staticPower[channelId] += (int32_t)n * slotPower[slot];
+    }
+
+    /**
+     * @brief Computes the dimmed color of a group slot for the next output
+     * @param g Index of the group slot, counted from SLOT_INSTR
+     * @return The group color scaled by the integer scale, or the next higher one on a dither carry
+     */
+    CRGB groupShade(uint8_t g) {
+        uint16_t scale = groupLevel[g] >> 8;
+#ifdef BACKLIGHT_DITHERING
+        uint8_t level = scale >> 8;
+        if (level < DITHER_MAX_LEVEL) {
+            uint8_t error = ditherError[g] + (scale & 0xff);
+            if (error < ditherError[g]) level++;                      // Carry: show the fraction in this frame
+            ditherError[g] = error;
+        } else {
+            level = min(255, (scale + 0x80) >> 8);                    // Round to the nearest integer scale
+        }
+#else
+        uint8_t level = min(255, (scale + 0x80) >> 8);                // Round to the nearest integer scale
+        if (!level && scale) level = 1;                               // Any non-zero dimmer keeps the LEDs lit
+#endif
+        CRGB color = groupColor[g];
+        color.nscale8_video(level);
+        return color;
+    }
+
+    /**
+     * @brief Private constructor to enforce singleton pattern
+     */
+    Palette() {
+        for (uint8_t s = 0; s < SIZE; s++) {
+            colors[s] = NVIS_BLACK;
+            slotUsers[s] = 0;
+            slotPower[s] = 0;
+        }
+        for (uint8_t c = 0; c < MAX_CHANNELS; c++) {
+            staticPower[c] = 0;
+            rainbowLedCount[c] = 0;
+            for (uint8_t g = 0; g < GROUP_SLOTS; g++) groupLedCount[c][g] = 0;
+        }
+        rainbowPower = 0;
+        rampMs = 0;
+        lastRampMs = 0;
+        channelCount = 0;
+        staticEnd = SLOT_STATIC;
+        for (uint8_t g = 0; g < GROUP_SLOTS; g++) {
+            groupColor[g] = NVIS_BLACK;
+            groupScale[g] = 0;
+            groupLevel[g] = 0;
+            groupRate[g] = 0;
+            ditherError[g] = 0;
+        }
+    }
+};
+
+// Initialize static instance pointer
+Palette* Palette::instance = nullptr;
+
+#endif
@@ -17,12 +17,21 @@
  * @brief     Abstract base class for all panels. Each panel must be a derived class from this base class.
  * @details   It provides functions that are repeatedly required across all panels: 
  *            setInstrLights(), setIndicatorColor(), setFloodlights().
- *            Panels are added to Channels. For memory efficiency, panels are organized in a linked list within each 
- *            channel. This conserves stack memory.
- *            This approach avoids allocating fixed-size arrays for panel pointers in each channel, 
- *            which would exhaust the limited stack space on the Arduino Mega 2560 (I tested it).
- *            Instead, this class provides a pointer to the next panel in its channel.
- *            Thus,the parent channels still can iterate through all of their panels.
+ *            Panels are added to Channels, which keep a small contiguous array of panel pointers (see Channel.h).
+ *            Each panel is a singleton in static storage (a function-local static in its getInstance()), so that no
+ *            panel is allocated on the heap. The accessors below are non-virtual and inline, so the per-LED loops
+ *            compile to plain field reads.
+ *            Each panel describes its LEDs as a short PROGMEM table of runs (consecutive LEDs sharing a role, see
+ *            LedStruct.h). When the panel is added to a channel, its runs are indexed by role once (one byte per run
+ *            and three per role, in pools shared by all panels), so a role update reads only the runs of that role.
+ *            The dimmer setters fill their role only once: afterwards, the LEDs stay on their group slot and a
+ *            dimmer change only recolors the slot.
+ *            LEDs hold palette slot indices (see Palette.h): dimmable lights point to a group slot whose color follows
+ *            the dimmer, indicators point to the static slot of their color. LEDs are only written if their slot
+ *            actually changes. Only then, the panel marks its channel as dirty, so that the board outputs just the
+ *            channels that changed.
+ *            Simple on/off indicators are declared as a PROGMEM table of IndicatorBinding entries, served by one
+ *            IndicatorBindings listener per panel instead of one DCS-BIOS IntegerBuffer per indicator.
  *********************************************************************************************************************/
 
 
@@ -37,35 +46,49 @@
 #include "LedStruct.h"
 #include "LedUpdateState.h"
 #include "Colors.h"
+#include "Gamma.h"
+#include "Palette.h"
+
+class IndicatorBindings;
 
 class Panel {
 public:
+    static const uint8_t MAX_INDEXED_RUNS = 144;                      // LED runs of all panels (sketch: 112)
+    static const uint8_t MAX_INDEXED_ROLES = 112;                     // Distinct roles of all panels (sketch: 91)
+
     /**
      * @brief Gets the start index of this panel on the LED strip
      * @return The start index
      */
-    virtual int getStartIndex() const { return panelStartIndex; }
+    int getStartIndex() const { return panelStartIndex; }
 
     /**
      * @brief Gets the number of LEDs in this panel
      * @return The LED count
      */
-    virtual int getLedCount() const { return ledCount; }
+    int getLedCount() const { return ledCount; }
 
     /**
-     * @brief Gets the LED table for this panel
-     * @return Pointer to the LED table
+     * @brief Gets the PROGMEM LED run table for this panel
+     * @return Pointer to the run table
      */
-    virtual const Led* getLedTable() const { return ledTable; }
+    const LedRun* getLedRuns() const { return ledRuns; }
+
+    /**
+     * @brief Gets the number of entries in the LED run table
+     * @return The run count
+     */
+    uint8_t getRunCount() const { return runCount; }
 
     /**
      * @brief Gets the LED strip for this panel
      * @return Pointer to the LED strip
      */
-    virtual CRGB* getLedStrip() const { return ledStrip; }
+    uint8_t* getLedStrip() const { return ledStrip; }
     
-    // Add friend declaration to allow Channel to access nextPanel and its protected methods
+    // Add friend declaration to allow Channel to access its protected methods
     friend class Channel;
+    friend class IndicatorBindings;
     
 protected:
     /**
@@ -76,19 +99,132 @@ protected:
         current_backl_brightness = 0;
         current_console_brightness = 0;
         current_flood_brightness = 0;
-        nextPanel = nullptr;  // Initialize next panel pointer
+        ledRuns = nullptr;    // Set by setLedRuns() in the derived panel's constructor
+        runCount = 0;
+        channelDirty = nullptr; // Set by Channel::addPanel()
+        channelId = 0;          // Set by Channel::addPanel()
+        bindings = nullptr;     // Set by the IndicatorBindings member of panels that have one
+        runOrder = nullptr;     // Set by indexRoles()
+        roles = nullptr;        // Set by indexRoles()
+        roleCount = 0;
+        filledGroups = 0;       // No role on its group slot yet
     }
 
+    /**
+     * @brief Group roles whose LEDs are known to be on their group slot (bits of filledGroups)
+     */
+    enum FilledGroup : uint8_t {
+        FILLED_INSTR = 0x01,                                          // LED_INSTR_BL and LED_JETT_STATION_BL
+        FILLED_CONSOLE = 0x02,                                        // LED_CONSOLE_BL
+        FILLED_FLOOD = 0x04                                           // LED_FLOOD
+    };
+
 
     int panelStartIndex;                                              // Start index of the panel on the LED strip
     int ledCount;                                                     // Number of LEDs in the panel
-    const Led* ledTable;                                              // Pointer to the LED table
-    CRGB* ledStrip;                                                   // Pointer to the LED strip
+    const LedRun* ledRuns;                                            // Pointer to the PROGMEM LED run table
+    uint8_t runCount;                                                 // Number of entries in ledRuns
+    uint8_t* ledStrip;                                                // Pointer to the LED strip (palette slot indices)
     uint16_t current_backl_brightness;                                // Current br. value for backlights (0-65535)
     uint16_t current_console_brightness;                              // Current br. value for console lights (0-65535)
     uint16_t current_flood_brightness;                                // Current br. value for floodlights (0-65535)
-    Panel* nextPanel;                                                 // Pointer to next panel in the channel
+    bool* channelDirty;                                               // Dirty flag of the channel this panel is on
+    uint8_t channelId;                                                // Palette id of the channel this panel is on
+    IndicatorBindings* bindings;                                      // Indicator bindings of this panel, if any
+    const uint8_t* runOrder;                                          // Run numbers grouped by role, in runIndex
+    const RoleRuns* roles;                                            // Runs of each role, in roleIndex
+    uint8_t roleCount;                                                // Number of entries in roles
+    uint8_t filledGroups;                                             // FilledGroup bits
+
+    static uint8_t runIndex[MAX_INDEXED_RUNS];                        // Pool of the runOrder lists of all panels
+    static RoleRuns roleIndex[MAX_INDEXED_ROLES];                     // Pool of the roles lists of all panels
+    static uint8_t runIndexUsed;                                      // Entries used in runIndex
+    static uint8_t roleIndexUsed;                                     // Entries used in roleIndex
+
+
+    /**
+     * @brief Sets the PROGMEM LED run table of this panel
+     * @param runs The run table, validated at compile time by ledRunsValid()
+     * @see This method is called by the constructors of derived panel classes
+     */
+    template<size_t N>
+    void setLedRuns(const LedRun (&runs)[N]) {
+        static_assert(N <= 255, "Too many LED runs for one panel");
+        ledRuns = runs;
+        runCount = N;
+    }
+
+    /**
+     * @brief Indexes the runs of this panel by role
+     * @details Lists the run numbers grouped by role (runOrder) and, per role, the first of its runs in that list
+     *          and their count (roles). Both are taken from the pools shared by all panels.
+     * @return False if a pool is full
+     * @see This method is called by Channel::addPanel()
+     */
+    bool indexRoles() {
+        if (!ledRuns) return true;
+        uint8_t* order = runIndex + runIndexUsed;
+        RoleRuns* entries = roleIndex + roleIndexUsed;
+        uint8_t indexed = 0;
+        uint8_t entryCount = 0;
+        for (uint8_t r = 0; r < runCount; r++) {
+            uint8_t role = pgm_read_byte(&ledRuns[r].role);
+            bool known = false;
+            for (uint8_t e = 0; e < entryCount; e++) known |= entries[e].role == role;
+            if (known) continue;                                      // Indexed with the first run of its role
+            if (roleIndexUsed + entryCount >= MAX_INDEXED_ROLES) return false;
+            RoleRuns& entry = entries[entryCount++];
+            entry.role = role;
+            entry.first = indexed;
+            entry.count = 0;
+            for (uint8_t s = r; s < runCount; s++) {
+                if (pgm_read_byte(&ledRuns[s].role) != role) continue;
+                if (runIndexUsed + indexed >= MAX_INDEXED_RUNS) return false;
+                order[indexed++] = s;
+                entry.count++;
+            }
+        }
+        runIndexUsed += indexed;
+        roleIndexUsed += entryCount;
+        runOrder = order;
+        roles = entries;
+        roleCount = entryCount;
+        return true;
+    }
+
+    /**
+     * @brief Sets all LEDs of one role to a palette slot, run by run
+     * @param role The role of LEDs to update
+     * @param slot The palette slot to set
+     * @return True if at least one LED changed its slot
+     * @see This method is called by the set...() methods of this class
+     */
+    bool fillRole(uint8_t role, uint8_t slot) {
+        const RoleRuns* entry = roles;
+        const RoleRuns* end = roles + roleCount;
+        while (entry < end && entry->role != role) entry++;
+        if (entry == end) return false;                               // No LEDs with this role (or not indexed)
+
+        uint8_t* panelLeds = ledStrip + panelStartIndex;
+        Palette* palette = Palette::getInstance();
+        bool changed = false;
+        for (uint8_t i = 0; i < entry->count; i++) {
+            const LedRun* run = &ledRuns[runOrder[entry->first + i]];  // Only the runs of this role are read
+            changed |= palette->assign(&panelLeds[pgm_read_word(&run->start)], pgm_read_word(&run->count), slot,
+                                       channelId);
+        }
+        return changed;
+    }
 
+    /**
+     * @brief Marks the panel's channel as dirty if any of its LEDs changed
+     * @param changed True if at least one LED changed its color
+     */
+    void markChanged(bool changed) {
+        if (!changed) return;                                         // No-op updates do not trigger an output
+        if (channelDirty) *channelDirty = true;
+        LedUpdateState::getInstance()->setUpdateFlag(true);           // Inform that LEDs need to be updated
+    }
 
     /**
      * @brief Set the color of all instrument backlight LEDs
@@ -97,28 +233,17 @@ protected:
      * @see This method is called by Channel::updateInstrLights()
      */
     void setInstrLights(uint16_t newValue, const CRGB& color = NVIS_GREEN_A) {                           
-        if (!getLedStrip() || !getLedTable()) return;                 // Safety checks
+        if (!ledStrip || !ledRuns) return;                              // Safety checks
         if (newValue == current_backl_brightness) return;             // Exit if no brightness change
-        int scale = map(newValue, 0, 65535, 0, 255);                  // Map the brightness scale factor to a range of 0-255
-        CRGB target = color;
-        target.nscale8_video(scale);                                  // Use FastLED's nscale8_video to apply the scale factor
-        CRGB target2 = NVIS_CGRB_GREEN_A;                             // For GRB LEDs (e.g. Radar Altimeter and Standby Instruments)
-        target2.nscale8_video(scale);
+        uint16_t scale = dimmerToScale(newValue);                     // Perceptual dimming curve, see Gamma.h
         current_backl_brightness = newValue;                          // Update and save the current brightness value
-                 
-        int n = getLedCount();
-        for (int i = 0; i < n; i++) {                                 // For each LED, read info from PROGMEM; if LED is BACKLIGHT, set color
-            Led led;
-            memcpy_P(&led, &getLedTable()[i], sizeof(Led));           // getLedTable() accesses the panel's LED table
-            uint16_t ledIndex = led.index + getStartIndex();
-            if (led.role == LED_INSTR_BL) {
-                getLedStrip()[ledIndex] = target;
-            }
-            if (led.role == LED_INSTR_BL_CGRB) {
-                getLedStrip()[ledIndex] = target2;
-            }
-        }
-        LedUpdateState::getInstance()->setUpdateFlag(true);           // Inform that LEDs need to be updated
+
+        Palette::getInstance()->setGroupLevel(Palette::SLOT_INSTR, color, scale);  // Dims all channels at once
+        if (filledGroups & FILLED_INSTR) return;                      // LEDs already on the slot: recolored above
+        bool changed = fillRole(LED_INSTR_BL, Palette::SLOT_INSTR);   // Only the runs with backlight roles are touched
+        changed |= fillRole(LED_JETT_STATION_BL, Palette::SLOT_STATION);  // Lit by the board while the dimmer is on
+        filledGroups |= FILLED_INSTR;
+        markChanged(changed);                                         // Inform that LEDs need to be updated
     }
 
     /**
@@ -128,23 +253,14 @@ protected:
      * @see This method is called by Channel::updateConsoleLights()
      */
     void setConsoleLights(uint16_t newValue, const CRGB& color = NVIS_GREEN_A) {                        // Set the color of all LEDs with role LED_CONSOLE_BL
-        if (!getLedStrip() || !getLedTable()) return;                 // Safety checks
+        if (!ledStrip || !ledRuns) return;                              // Safety checks
         if (newValue == current_console_brightness) return;           // Exit if no brightness change
-        int scale = map(newValue, 0, 65535, 0, 255);                  // Map the brightness scale factor to a range of 0-255
-        CRGB target = color;
-        target.nscale8_video(scale);                                  // Use FastLED's nscale8_video to apply the scale factor
         current_console_brightness = newValue;                        // Update and save the current brightness value
-                 
-        int n = getLedCount();
-        for (int i = 0; i < n; i++) {                                 // For each LED, read info from PROGMEM; if LED is BACKLIGHT, set color
-            Led led;
-            memcpy_P(&led, &getLedTable()[i], sizeof(Led));           // getLedTable() accesses the panel's LED table
-            uint16_t ledIndex = led.index + getStartIndex();
-            if (led.role == LED_CONSOLE_BL) {
-                getLedStrip()[ledIndex] = target;
-            }
-        }
-        LedUpdateState::getInstance()->setUpdateFlag(true);           // Inform that LEDs need to be updated
+
+        Palette::getInstance()->setGroupLevel(Palette::SLOT_CONSOLE, color, dimmerToScale(newValue));
+        if (filledGroups & FILLED_CONSOLE) return;                    // Same as setInstrLights()
+        filledGroups |= FILLED_CONSOLE;
+        markChanged(fillRole(LED_CONSOLE_BL, Palette::SLOT_CONSOLE)); // Only the runs with console role are touched
     }
 
     /**
@@ -154,68 +270,214 @@ protected:
      * @see This method is called by derived panel classes to update indicator lights
      */
     void setIndicatorColor(LedRole role, const CRGB& color) {         // Set color of specific LEDs ("role" parameter)
-        if (!getLedStrip() || !getLedTable()) return;                 
-        int n = getLedCount();                                        
-        for (int i = 0; i < n; i++) {                                 
-            Led led;
-            memcpy_P(&led, &getLedTable()[i], sizeof(Led));
-            uint16_t ledIndex = led.index + getStartIndex();
-            if (led.role == role) {
-                getLedStrip()[ledIndex] = color;
-            }
-        }
-        LedUpdateState::getInstance()->setUpdateFlag(true);           // Inform that LEDs need to be updated
+        if (!ledStrip || !ledRuns) return;
+        if (role == LED_INSTR_BL || role == LED_JETT_STATION_BL) filledGroups &= ~FILLED_INSTR;
+        if (role == LED_CONSOLE_BL) filledGroups &= ~FILLED_CONSOLE;
+        if (role == LED_FLOOD) filledGroups &= ~FILLED_FLOOD;
+        markChanged(fillRole(role, Palette::getInstance()->intern(color)));  // Marks the channel only if a slot changed
     }
 
     /**
      * @brief Sets the brightness of floodlight LEDs
      * @param newValue The new brightness value (0-65535)
+     * @param color The color to set (defaults to NVIS_WHITE)
      * @see This method is called by Channel::updateFloodLights()
      */
-    void setFloodlights(uint16_t newValue) {                          // Set the brightness of LEDs with role LED_FLOOD
-        if (!getLedStrip() || !getLedTable()) return;                 // Same structure as setInstrLights()
+    void setFloodlights(uint16_t newValue, const CRGB& color = NVIS_WHITE) {                          // Set the brightness of LEDs with role LED_FLOOD
+        if (!ledStrip || !ledRuns) return;                              // Same structure as setInstrLights()
         if (newValue == current_flood_brightness) return;             
         current_flood_brightness = newValue;
         
-        uint8_t scale = map(newValue, 0, 65535, 0, 255);
-        
-        CRGB target = NVIS_WHITE;
-        target.nscale8_video(scale);
-        
-        int n = getLedCount();
-        for (int i = 0; i < n; i++) {                                 
-            Led led;
-            memcpy_P(&led, &getLedTable()[i], sizeof(Led));           
-            uint16_t ledIndex = led.index + getStartIndex();
-            if (led.role == LED_FLOOD) {
-                getLedStrip()[ledIndex] = target;
-            }
+
+        Palette::getInstance()->setGroupLevel(Palette::SLOT_FLOOD, color, dimmerToScale(newValue));
+        if (filledGroups & FILLED_FLOOD) return;
+        filledGroups |= FILLED_FLOOD;
+        markChanged(fillRole(LED_FLOOD, Palette::SLOT_FLOOD));
+    }
+
+    /**
+     * @brief Writes the palette slot of each LED run of this panel to a snapshot
+     * @details All LEDs of a run share one role and thus one slot, so one byte per run is enough.
+     * @param out Snapshot buffer, at least getRunCount() bytes
+     * @return Pointer behind the bytes written
+     * @see This method is called by Channel::saveSnapshot()
+     */
+    uint8_t* saveSnapshot(uint8_t* out) const {
+        if (!ledStrip || !ledRuns) return out;
+        const uint8_t* panelLeds = ledStrip + panelStartIndex;
+        for (uint8_t r = 0; r < runCount; r++) {
+            *out++ = panelLeds[pgm_read_word(&ledRuns[r].start)];
         }
-        LedUpdateState::getInstance()->setUpdateFlag(true);           // Inform that LEDs need to be updated
+        return out;
+    }
+
+    /**
+     * @brief Sets each LED run of this panel back to its slot from a snapshot, and the dimmer values with it
+     * @param in Snapshot data written by saveSnapshot()
+     * @param instr Instrument dimmer value at the time of the snapshot
+     * @param console Console dimmer value at the time of the snapshot
+     * @param flood Flood dimmer value at the time of the snapshot
+     * @return Pointer behind the bytes read
+     * @see This method is called by Channel::restoreSnapshot()
+     */
+    const uint8_t* restoreSnapshot(const uint8_t* in, uint16_t instr, uint16_t console, uint16_t flood) {
+        if (!ledStrip || !ledRuns) return in;
+        uint8_t* panelLeds = ledStrip + panelStartIndex;
+        Palette* palette = Palette::getInstance();
+        bool changed = false;
+        LedRun run;
+        for (uint8_t r = 0; r < runCount; r++) {
+            memcpy_P(&run, &ledRuns[r], sizeof(LedRun));
+            changed |= palette->assign(&panelLeds[run.start], run.count, *in++, channelId);
+        }
+        current_backl_brightness = instr;                             // The group slots are restored by the board
+        current_console_brightness = console;
+        current_flood_brightness = flood;
+        filledGroups = 0;                                             // Runs may be on any slot now
+        markChanged(changed);
+        return in;
     }
 
     /**
      * @brief Turns off all lights in this panel, irrespective of their role, and resets brightness state
      * @see This method is called by Channel::setAllLightsOff()
+     * @remark Defined after IndicatorBindings, which it resets
      */
-    void setAllLightsOff() {                                          // Turn off all lights and reset brightness state
-        if (!getLedStrip() || !getLedTable()) return;                 // Safety checks
-        
-        CRGB* ledArray = getLedStrip();
-        int startIndex = getStartIndex();
-        int panelLedCount = getLedCount();
-        
-        for (int i = 0; i < panelLedCount; i++) {
-            ledArray[startIndex + i] = NVIS_BLACK;
+    void setAllLightsOff();
+};
+
+
+/**********************************************************************************************************************
+ * @brief   One DCS-BIOS indicator output driving the LEDs of one role.
+ * @details address, mask and shift are the DCS-BIOS control triple, so the FA_18C_hornet_... macros can be used
+ *          as-is. The indicator is on if any of its masked bits is set.
+ * @remark  Tables of this struct are constexpr and stored in PROGMEM; see IndicatorBindings.
+ *********************************************************************************************************************/
+struct IndicatorBinding {
+    uint16_t address;             // DCS-BIOS export address
+    uint16_t mask;                // Bits of the indicator within the 16-bit word
+    uint8_t  shift;               // Position of the lowest bit of the mask
+    uint8_t  role;                // Role of the LEDs driven by the indicator (LedRole, stored in one byte)
+    CRGB     onColor;             // Color while the indicator is on
+    CRGB     offColor;            // Color while the indicator is off
+};
+
+
+/**********************************************************************************************************************
+ * @brief   Serves a panel's PROGMEM table of indicator bindings with a single DCS-BIOS export listener.
+ * @details Replaces one IntegerBuffer and one static callback per indicator. The listener covers the address range
+ *          of the table. onDcsBiosWrite() runs in the serial RX interrupt: it only compares the bound bits against
+ *          their last state and records the bindings that changed. loop() then updates the LEDs of just those
+ *          bindings in the main loop. A table may hold up to 32 bindings (one bit each).
+ * @remark  Declare it as a member of the panel, after the table: IndicatorBindings indicators{this, table};
+ *********************************************************************************************************************/
+class IndicatorBindings : public DcsBios::ExportStreamListener {
+public:
+    /**
+     * @brief Constructs the listener for a binding table and attaches it to the panel
+     * @param panel The panel whose LEDs the bindings drive
+     * @param table The constexpr PROGMEM binding table
+     */
+    template<size_t N>
+    IndicatorBindings(Panel* panel, const IndicatorBinding (&table)[N])
+        : DcsBios::ExportStreamListener(firstAddress(table, N), lastAddress(table, N)),
+          panel(panel), table(table), count(N), state(0), known(0), pending(0) {
+        static_assert(N > 0 && N <= 32, "An IndicatorBindings table holds 1 to 32 bindings");
+        panel->bindings = this;
+    }
+
+    /**
+     * @brief Records the bindings whose bits changed in a DCS-BIOS write
+     * @param address The DCS-BIOS address written
+     * @param value The 16-bit value written
+     * @see This method is called by the DCS-BIOS parser, in the serial RX interrupt
+     */
+    void onDcsBiosWrite(unsigned int address, unsigned int value) override {
+        uint32_t bit = 1;
+        for (uint8_t i = 0; i < count; i++, bit <<= 1) {
+            if (pgm_read_word(&table[i].address) != address) continue;
+            bool on = (value & pgm_read_word(&table[i].mask)) != 0;
+            if ((known & bit) && on == ((state & bit) != 0)) continue; // Unchanged: nothing to dispatch
+            if (on) state |= bit;
+            else state &= ~bit;
+            known |= bit;
+            pending |= bit;
         }
-        
-        // Reset all brightness variables to 0
-        current_backl_brightness = 0;
-        current_console_brightness = 0;
-        current_flood_brightness = 0;
-        
-        LedUpdateState::getInstance()->setUpdateFlag(true);           // Inform that LEDs need to be updated
+    }
+
+    /**
+     * @brief Updates the LEDs of all bindings that changed since the last call
+     * @see This method is called by DcsBios::loop()
+     */
+    void loop() override {
+        if (!pending) return;
+        noInterrupts();                                               // Take a consistent copy from the RX interrupt
+        uint32_t changed = pending;
+        uint32_t on = state;
+        pending = 0;
+        interrupts();
+
+        IndicatorBinding binding;
+        uint32_t bit = 1;
+        for (uint8_t i = 0; i < count; i++, bit <<= 1) {
+            if (!(changed & bit)) continue;
+            memcpy_P(&binding, &table[i], sizeof(IndicatorBinding));
+            panel->setIndicatorColor((LedRole)binding.role, (on & bit) ? binding.onColor : binding.offColor);
+        }
+    }
+
+    /**
+     * @brief Forgets the last known indicator states, so the next write of each binding updates its LEDs
+     * @see This method is called by Panel::setAllLightsOff()
+     */
+    void invalidate() {
+        noInterrupts();
+        known = 0;
+        interrupts();
+    }
+
+private:
+    Panel* panel;                                                     // Panel whose LEDs are driven
+    const IndicatorBinding* table;                                    // PROGMEM binding table
+    uint8_t count;                                                    // Number of bindings in the table
+    volatile uint32_t state;                                          // Last state of each binding (1 = on)
+    volatile uint32_t known;                                          // Bindings whose state has been received
+    volatile uint32_t pending;                                        // Bindings changed since the last loop()
+
+    static unsigned int firstAddress(const IndicatorBinding* table, uint8_t n) {
+        unsigned int first = 0xffff;
+        for (uint8_t i = 0; i < n; i++) first = min(first, (unsigned int)pgm_read_word(&table[i].address));
+        return first;
+    }
+
+    static unsigned int lastAddress(const IndicatorBinding* table, uint8_t n) {
+        unsigned int last = 0;
+        for (uint8_t i = 0; i < n; i++) last = max(last, (unsigned int)pgm_read_word(&table[i].address));
+        return last;
     }
 };
 
+
+void Panel::setAllLightsOff() {                                       // Turn off all lights and reset brightness state
+    if (!getLedStrip() || !getLedRuns()) return;                      // Safety checks
+    
+    bool changed = Palette::getInstance()->assign(getLedStrip() + getStartIndex(), getLedCount(),
+                                                  Palette::SLOT_BLACK, channelId);
+    
+    // Reset all brightness variables to 0
+    current_backl_brightness = 0;
+    current_console_brightness = 0;
+    current_flood_brightness = 0;
+    filledGroups = 0;                                                 // All LEDs are black now
+    if (bindings) bindings->invalidate();                             // Re-apply the indicators on the next DCS write
+    
+    markChanged(changed);                                             // Inform that LEDs need to be updated
+}
+
+// Initialize static role index pools
+uint8_t Panel::runIndex[Panel::MAX_INDEXED_RUNS];
+RoleRuns Panel::roleIndex[Panel::MAX_INDEXED_ROLES];
+uint8_t Panel::runIndexUsed = 0;
+uint8_t Panel::roleIndexUsed = 0;
+
 #endif 
\ No newline at end of file
@@ -0,0 +1,109 @@
+/**********************************************************************************************************************
+ *        ____                   _    _                       _
+ *       / __ \                 | |  | |                     | |
+ *      | |  | |_ __   ___ _ __ | |__| | ___  _ __ _ __   ___| |_
+ *      | |  | | '_ \ / _ \ '_ \|  __  |/ _ \| '__| '_ \ / _ \ __|
+ *      | |__| | |_) |  __/ | | | |  | | (_) | |  | | | |  __/ |_
+ *       \____/| .__/ \___|_| |_|_|  |_|\___/|_|  |_| |_|\___|\__|
+ *             | |
+ *             |_|
+ *   ----------------------------------------------------------------------------------
+ *
+ * @file      BaselineTable.h
+ * @author    Ulukaii
+ * @date      17.10.2026
+ * @version   t 0.4.0
+ * @copyright Copyright 2016-2026 OpenHornet. See 2A13-BACKLIGHT_CONTROLLER.ino for details.
+ * @brief     The former per-LED panel tables and table scan, kept as the baseline of the panel benchmarks.
+ * @details   Before the run tables (see LedStruct.h), each panel had a PROGMEM table of one {index, role} entry per
+ *            LED, and every update read all entries from flash and wrote the matching LEDs of a CRGB strip.
+ *            BaselineTable<> rebuilds such a table at compile time from a panel's run table, so the baseline always
+ *            describes the same LEDs as the current panel. baselineSetRole() is the former setIndicatorColor() loop.
+ *            Only the benchmarks include this file.
+ *********************************************************************************************************************/
+
+#ifndef __BASELINE_TABLE_H
+#define __BASELINE_TABLE_H
+
+#include "FastLED.h"
+#include "../LedStruct.h"
+
+/**
+ * @brief One entry of the former per-LED table
+ */
+struct BaselineLed {
+    uint16_t index;               // Local position of the LED on the panel, starts at 0
+    LedRole  role;                // Role of the LED
+};
+
+/**
+ * @brief Checks whether an LED is in one of the runs from run r on
+ */
+constexpr bool baselineInRun(const LedRun* runs, uint8_t n, uint16_t led, uint8_t r = 0) {
+    return r < n && ((led >= runs[r].start && led < runs[r].start + runs[r].count) ||
+                     baselineInRun(runs, n, led, r + 1));
+}
+
+/**
+ * @brief Gets the role of one LED from a run table, checking runs from run r on
+ */
+constexpr LedRole baselineRoleAt(const LedRun* runs, uint8_t n, uint16_t led, uint8_t r = 0) {
+    return (r >= n) ? LED_INSTR_BL
+         : (led >= runs[r].start && led < runs[r].start + runs[r].count) ? (LedRole)runs[r].role
+         : baselineRoleAt(runs, n, led, r + 1);
+}
+
+/**
+ * @brief Checks that the LEDs first to last - 1 are all in a run, as every LED had an entry in the former table
+ * @details Splits the range in halves, so that the recursion depth stays within the compiler's constexpr limit.
+ */
+constexpr bool baselineCovered(const LedRun* runs, uint8_t n, uint16_t first, uint16_t last) {
+    return (last - first <= 1) ? (first >= last || baselineInRun(runs, n, first))
+         : baselineCovered(runs, n, first, first + (last - first) / 2) &&
+           baselineCovered(runs, n, first + (last - first) / 2, last);
+}
+
+template<uint16_t... I> struct BaselineIndices {};
+template<uint16_t N, uint16_t... I> struct MakeBaselineIndices : MakeBaselineIndices<N - 1, N - 1, I...> {};
+template<uint16_t... I> struct MakeBaselineIndices<0, I...> { typedef BaselineIndices<I...> type; };
+
+/**
+ * @brief The former PROGMEM table of a panel: one entry per LED, in LED order
+ * @tparam RUNS The panel's constexpr run table
+ * @tparam N_RUNS Number of runs in the table
+ * @tparam N_LEDS Number of LEDs in the panel
+ */
+template<const LedRun* RUNS, uint8_t N_RUNS, uint16_t N_LEDS,
+         typename = typename MakeBaselineIndices<N_LEDS>::type>
+struct BaselineTable;
+
+template<const LedRun* RUNS, uint8_t N_RUNS, uint16_t N_LEDS, uint16_t... I>
+struct BaselineTable<RUNS, N_RUNS, N_LEDS, BaselineIndices<I...>> {
+    static_assert(baselineCovered(RUNS, N_RUNS, 0, N_LEDS), "Run table does not cover every LED of the panel");
+    static constexpr BaselineLed leds[N_LEDS] PROGMEM = {{I, baselineRoleAt(RUNS, N_RUNS, I)}...};
+};
+
+template<const LedRun* RUNS, uint8_t N_RUNS, uint16_t N_LEDS, uint16_t... I>
+constexpr BaselineLed BaselineTable<RUNS, N_RUNS, N_LEDS, BaselineIndices<I...>>::leds[N_LEDS] PROGMEM;
+
+/**
+ * @brief Sets the LEDs of one role to a color by scanning the whole per-LED table, as the former panels did
+ * @param table The per-LED PROGMEM table
+ * @param ledCount Number of LEDs in the panel
+ * @param startIndex Start index of the panel on the strip
+ * @param strip The CRGB strip
+ * @param role The role of LEDs to update
+ * @param color The color to set
+ */
+inline void baselineSetRole(const BaselineLed* table, uint16_t ledCount, uint16_t startIndex, CRGB* strip,
+                            LedRole role, const CRGB& color) {
+    for (uint16_t i = 0; i < ledCount; i++) {
+        BaselineLed led;
+        memcpy_P(&led, &table[i], sizeof(BaselineLed));
+        if (led.role == role) {
+            strip[led.index + startIndex] = color;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,147 @@
+/**
+* Panel Benchmark Sketch
+* Measures CPU cycles per LED role update on the Arduino Mega 2560, for the former scan of a per-LED PROGMEM table
+* into a CRGB strip (baseline, see BaselineTable.h) and for the current PROGMEM run tables writing palette slots.
+* Also reports the flash used by both tables of each panel.
+* Flash to a bare Mega (no LEDs or DCS-BIOS needed), open the serial monitor at 115200 baud.
+* Timer1 runs without prescaler, so one count is one CPU cycle (62.5 ns at 16 MHz).
+* The same cases run on the host with "make panels" in ../../host, reporting nanoseconds instead of cycles.
+*/
+
+#define DCSBIOS_DEFAULT_SERIAL                                        // No IRQ serial: Serial is used for the report
+#define DCSBIOS_DISABLE_SERVO
+
+#include "FastLED.h"
+#include "DcsBios.h"
+#include "../Panel.h"
+#include "../Channel.h"
+#include "../../panels/1A4_L_EWI.h"
+#include "../../panels/5A3A1_CAUTION.h"
+#include "../../panels/2A2A1A1_Jett_Station_Panel.h"
+#include "../../panels/5A5_RC2_ALL_PANELS.h"
+#include "BaselineTable.h"
+
+const int RUNS = 64;                                                  // Number of runs averaged per measurement
+
+uint8_t ewiLeds[L_EWI_LED_COUNT];
+uint8_t rc1Leds[CAUTION_LED_COUNT];
+uint8_t lipLeds[JETT_STATION_LED_COUNT];
+uint8_t rc2Leds[RC2_ALL_PANELS_LED_COUNT];
+CRGB outputLeds[RC2_ALL_PANELS_LED_COUNT];                            // Output buffer shared by the channels
+CRGB baselineStrip[RC2_ALL_PANELS_LED_COUNT];                         // CRGB strip written by the baseline scan
+
+Channel UIP_1(11, "Channel 3", ewiLeds, L_EWI_LED_COUNT);
+Channel RC_1(7, "Channel 7", rc1Leds, CAUTION_LED_COUNT);
+Channel LIP_1(13, "Channel 1", lipLeds, JETT_STATION_LED_COUNT);
+Channel RC_2(6, "Channel 8", rc2Leds, RC2_ALL_PANELS_LED_COUNT);
+
+typedef BaselineTable<lEwiLedRuns, sizeof(lEwiLedRuns) / sizeof(LedRun), L_EWI_LED_COUNT> EwiBaseline;
+typedef BaselineTable<cautionLedRuns, sizeof(cautionLedRuns) / sizeof(LedRun), CAUTION_LED_COUNT> CautionBaseline;
+typedef BaselineTable<jettStationLedRuns, sizeof(jettStationLedRuns) / sizeof(LedRun), JETT_STATION_LED_COUNT>
+    JettStationBaseline;
+typedef BaselineTable<rc2AllPanelsLedRuns, sizeof(rc2AllPanelsLedRuns) / sizeof(LedRun), RC2_ALL_PANELS_LED_COUNT>
+    Rc2Baseline;
+
+volatile uint16_t timerOverflows = 0;
+ISR(TIMER1_OVF_vect) { timerOverflows++; }
+
+/**
+ * @brief Gives the benchmark access to the protected Panel update methods
+ */
+struct PanelAccess : Panel {
+    static void setIndicator(Panel* p, LedRole role, const CRGB& color) {
+        (p->*(&PanelAccess::setIndicatorColor))(role, color);
+    }
+    static void setConsole(Panel* p, uint16_t value) {
+        (p->*(&PanelAccess::setConsoleLights))(value, NVIS_GREEN_A);
+    }
+};
+
+void startTimer() {
+    noInterrupts();
+    timerOverflows = 0;
+    TCCR1A = 0;
+    TCNT1 = 0;
+    TIFR1 = _BV(TOV1);
+    TCCR1B = _BV(CS10);                                               // No prescaler: count CPU cycles
+    interrupts();
+}
+
+uint32_t stopTimer() {
+    noInterrupts();
+    TCCR1B = 0;
+    uint32_t cycles = ((uint32_t)timerOverflows << 16) | TCNT1;
+    if (TIFR1 & _BV(TOV1)) cycles += 65536UL;                         // Overflow not yet counted by the ISR
+    interrupts();
+    return cycles;
+}
+
+void report(const char* name, uint16_t baselineBytes, uint32_t baseline, uint16_t runBytes, uint32_t runs) {
+    Serial.print(name);
+    Serial.print(F(": baseline "));
+    Serial.print(baseline / RUNS);
+    Serial.print(F(" cycles, "));
+    Serial.print(baselineBytes);
+    Serial.print(F(" bytes flash; runs "));
+    Serial.print(runs / RUNS);
+    Serial.print(F(" cycles, "));
+    Serial.print(runBytes);
+    Serial.println(F(" bytes flash"));
+}
+
+/**
+ * @brief Toggles one role RUNS times with the baseline scan and with the panel's run table, and reports both
+ */
+void benchIndicator(const char* name, const BaselineLed* table, Panel* p, LedRole role, const CRGB& color) {
+    startTimer();
+    for (int r = 0; r < RUNS; r++) {
+        baselineSetRole(table, p->getLedCount(), p->getStartIndex(), baselineStrip, role, (r & 1) ? color : NVIS_BLACK);
+        LedUpdateState::getInstance()->setUpdateFlag(true);           // As the former panels did after every update
+    }
+    uint32_t baseline = stopTimer();
+
+    startTimer();
+    for (int r = 0; r < RUNS; r++) PanelAccess::setIndicator(p, role, (r & 1) ? color : NVIS_BLACK);
+    uint32_t runs = stopTimer();
+
+    report(name, p->getLedCount() * sizeof(BaselineLed), baseline, p->getRunCount() * sizeof(LedRun), runs);
+}
+
+void setup() {
+    Serial.begin(115200);
+    Serial.println(F("Panel Benchmark Ready"));
+
+    Channel::setOutputBuffer(outputLeds, RC2_ALL_PANELS_LED_COUNT);   // As in the sketch: every channel gets its own
+    UIP_1.initialize();                                               // palette id, so assign() and setColor() keep
+    RC_1.initialize();                                                // their per-channel accounts
+    LIP_1.initialize();
+    RC_2.initialize();
+    UIP_1.addPanel<EwiPanel>();
+    RC_1.addPanel<CautionPanel>();
+    LIP_1.addPanel<JettStationPanel>();
+    RC_2.addPanel<Rc2AllPanels>();
+    TIMSK1 = _BV(TOIE1);                                              // Count Timer1 overflows for long runs
+
+    benchIndicator("L EWI master caution", EwiBaseline::leds, UIP_1.getPanel(0), LED_CAUTION, NVIS_YELLOW);
+    benchIndicator("Caution panel FUEL LO", CautionBaseline::leds, RC_1.getPanel(0), LED_FUEL_LO, NVIS_YELLOW);
+    benchIndicator("Jett station LO", JettStationBaseline::leds, LIP_1.getPanel(0), LED_JETT_LO_1, NVIS_WHITE);
+    benchIndicator("RC2 all panels (349 LEDs) console role", Rc2Baseline::leds, RC_2.getPanel(0), LED_CONSOLE_BL,
+                   NVIS_GREEN_A);
+
+    startTimer();
+    for (int r = 0; r < RUNS; r++) {                                  // Former setConsoleLights(): scale, then scan
+        CRGB target = NVIS_GREEN_A;
+        target.nscale8_video(map((r & 0xff) * 256, 0, 65535, 0, 255));
+        baselineSetRole(Rc2Baseline::leds, RC2_ALL_PANELS_LED_COUNT, 0, baselineStrip, LED_CONSOLE_BL, target);
+        LedUpdateState::getInstance()->setUpdateFlag(true);
+    }
+    uint32_t baseline = stopTimer();
+    startTimer();
+    for (int r = 0; r < RUNS; r++) PanelAccess::setConsole(RC_2.getPanel(0), (r & 0xff) * 256);
+    uint32_t runs = stopTimer();
+    report("RC2 setConsoleLights incl. scaling", RC2_ALL_PANELS_LED_COUNT * sizeof(BaselineLed), baseline,
+           RC_2.getPanel(0)->getRunCount() * sizeof(LedRun), runs);
+}
+
+void loop() {
+}
@@ -0,0 +1,204 @@
+/**********************************************************************************************************************
+ *        ____                   _    _                       _
+ *       / __ \                 | |  | |                     | |
+ *      | |  | |_ __   ___ _ __ | |__| | ___  _ __ _ __   ___| |_
+ *      | |  | | '_ \ / _ \ '_ \|  __  |/ _ \| '__| '_ \ / _ \ __|
+ *      | |__| | |_) |  __/ | | | |  | | (_) | |  | | | |  __/ |_
+ *       \____/| .__/ \___|_| |_|_|  |_|\___/|_|  |_| |_|\___|\__|
+ *             | |
+ *             |_|
+ *   ----------------------------------------------------------------------------------
+ *
+ * @file      Profiler.h
+ * @author    Ulukaii
+ * @date      17.10.2026
+ * @version   t 0.4.0
+ * @copyright Copyright 2016-2026 OpenHornet. See 2A13-BACKLIGHT_CONTROLLER.ino for details.
+ * @brief     Runtime profiler for the phases of loop(): call counts and min, average and max durations.
+ * @details   Only compiled in with BACKLIGHT_PROFILER defined (see 2A13-BACKLIGHT_CONTROLLER.ino); otherwise the
+ *            PROFILE_SCOPE() markers expand to nothing and cost neither memory nor time. The phases nest:
+ *            - LOOP:    one pass of loop()
+ *            - INPUT:   encoder event handling (Board::handleModeChange())
+ *            - MODE:    mode processing (Board::processMode()), including DCSBIOS
+ *            - DCSBIOS: DcsBios::loop(), i.e. parsing plus all panel callbacks and indicator bindings
+ *            - LEDS:    frame pacing and output (Board::updateLeds()), including OUTPUT
+ *            - OUTPUT:  output of one channel segment (palette expansion and strip output)
+ *            In addition, the free SRAM and the stack high-water mark are recorded. For the latter, begin() paints
+ *            the unused memory between heap and stack with a pattern; the bytes still holding the pattern have never
+ *            been touched by the stack (or the heap).
+ *            dump() sends the statistics as BL_PROFILE messages over the DCS-BIOS connection, where they show up in
+ *            the DCS-BIOS hub or connection log (DCS-BIOS ignores the unknown command), and starts a new interval.
+ * @remark    Technical implementation: singleton, like Board.
+ *********************************************************************************************************************/
+
+#ifndef __PROFILER_H
+#define __PROFILER_H
+
+#ifdef BACKLIGHT_PROFILER
+
+#include <Arduino.h>
+#include <stdio.h>
+#include "DcsBios.h"
+
+#ifdef __AVR__
+extern char __heap_start;                                             // End of .bss, start of the heap (avr-libc)
+extern char* __brkval;                                                // Current end of the heap, 0 if never used
+#endif
+
+class Profiler {
+public:
+    enum Phase : uint8_t {
+        PHASE_LOOP,                                                   // One pass of loop()
+        PHASE_INPUT,                                                  // Encoder event handling
+        PHASE_MODE,                                                   // Mode processing, including DCS-BIOS
+        PHASE_DCSBIOS,                                                // DcsBios::loop() with all panel callbacks
+        PHASE_LEDS,                                                   // Frame pacing and output
+        PHASE_OUTPUT,                                                 // Output of one channel segment
+        PHASE_COUNT
+    };
+
+    /**
+     * @brief Gets the singleton instance of the Profiler class
+     * @return Pointer to the singleton instance
+     */
+    static Profiler* getInstance() {
+        if (!instance) {
+            static Profiler profiler;
+            instance = &profiler;                                     // Static storage, no heap allocation
+        }
+        return instance;
+    }
+
+    /**
+     * @brief Paints the free memory between heap and stack, for the stack high-water mark
+     * @see This method is called first thing by setup() in 2A13-BACKLIGHT_CONTROLLER.ino
+     */
+    void begin() {
+#ifdef __AVR__
+        char here;
+        char* p = heapEnd();
+        while (p < &here - STACK_GUARD) *p++ = STACK_PAINT;           // Keep clear of this function's own frame
+#endif
+        reset();
+    }
+
+    /**
+     * @brief Adds one duration to the statistics of a phase
+     * @param phase The phase
+     * @param us Duration in microseconds
+     * @see This method is called by ProfileScope when it goes out of scope
+     */
+    void record(Phase phase, unsigned long us) {
+        PhaseStats& s = stats[phase];
+        s.count++;
+        s.total += us;
+        if (us < s.min) s.min = us;
+        if (us > s.max) s.max = us;
+    }
+
+    /**
+     * @brief Gets the number of free bytes between heap and stack right now
+     */
+    uint16_t getFreeSram() const {
+#ifdef __AVR__
+        char here;
+        return &here - heapEnd();
+#else
+        return 0;
+#endif
+    }
+
+    /**
+     * @brief Gets the number of bytes between heap and stack that the stack has never reached since begin()
+     */
+    uint16_t getStackUnused() const {
+#ifdef __AVR__
+        const char* p = heapEnd();
+        uint16_t unused = 0;
+        while (*p++ == STACK_PAINT) unused++;
+        return unused;
+#else
+        return 0;
+#endif
+    }
+
+    /**
+     * @brief Sends the statistics as BL_PROFILE messages over the DCS-BIOS connection and starts a new interval
+     * @details One message per phase ("LOOP n=1234 min=40 avg=310 max=14210", durations in microseconds) and one
+     *          for the memory ("SRAM free=2345 stack_unused=1987", in bytes).
+     * @see This method is called by Board::handleModeChange() on a long press of the encoder switch
+     */
+    void dump() {
+        static const char* const NAMES[PHASE_COUNT] = {"LOOP", "INPUT", "MODE", "DCSBIOS", "LEDS", "OUTPUT"};
+        char line[64];
+        for (uint8_t p = 0; p < PHASE_COUNT; p++) {
+            const PhaseStats& s = stats[p];
+            snprintf(line, sizeof(line), "%s n=%lu min=%lu avg=%lu max=%lu", NAMES[p], (unsigned long)s.count,
+                     (unsigned long)(s.count ? s.min : 0), (unsigned long)(s.count ? s.total / s.count : 0),
+                     (unsigned long)s.max);
+            sendDcsBiosMessage("BL_PROFILE", line);
+        }
+        snprintf(line, sizeof(line), "SRAM free=%u stack_unused=%u", getFreeSram(), getStackUnused());
+        sendDcsBiosMessage("BL_PROFILE", line);
+        reset();                                                      // The next dump covers the time since this one
+    }
+
+private:
+    static Profiler* instance;
+    static const char STACK_PAINT = 0x5a;                             // Pattern of untouched memory
+    static const uint8_t STACK_GUARD = 32;                            // Bytes below the painting frame left unpainted
+
+    struct PhaseStats {
+        uint32_t count;                                               // Number of calls
+        uint32_t total;                                               // Sum of all durations (us), for the average
+        uint32_t min;                                                 // Shortest duration (us)
+        uint32_t max;                                                 // Longest duration (us)
+    };
+    PhaseStats stats[PHASE_COUNT];
+
+    /**
+     * @brief Private constructor to enforce singleton pattern
+     */
+    Profiler() { reset(); }
+
+    void reset() {
+        for (uint8_t p = 0; p < PHASE_COUNT; p++) {
+            stats[p].count = 0;
+            stats[p].total = 0;
+            stats[p].min = 0xffffffff;
+            stats[p].max = 0;
+        }
+    }
+
+#ifdef __AVR__
+    static char* heapEnd() { return __brkval ? __brkval : &__heap_start; }
+#endif
+};
+
+// Initialize static instance pointer
+Profiler* Profiler::instance = nullptr;
+
+
+/**********************************************************************************************************************
+ * @brief   Measures the time from its construction to the end of its scope and records it for one phase.
+ * @remark  Use through PROFILE_SCOPE(phase).
+ *********************************************************************************************************************/
+class ProfileScope {
+public:
+    explicit ProfileScope(Profiler::Phase phase) : phase(phase), start(micros()) {}
+    ~ProfileScope() { Profiler::getInstance()->record(phase, micros() - start); }
+
+private:
+    Profiler::Phase phase;
+    unsigned long start;
+};
+
+#define PROFILE_SCOPE(phase) ProfileScope profileScope(Profiler::phase)
+
+#else
+
+#define PROFILE_SCOPE(phase)                                          // Profiler not compiled in
+
+#endif
+
+#endif
@@ -0,0 +1,237 @@
+/**********************************************************************************************************************
+ *        ____                   _    _                       _
+ *       / __ \                 | |  | |                     | |
+ *      | |  | |_ __   ___ _ __ | |__| | ___  _ __ _ __   ___| |_
+ *      | |  | | '_ \ / _ \ '_ \|  __  |/ _ \| '__| '_ \ / _ \ __|
+ *      | |__| | |_) |  __/ | | | |  | | (_) | |  | | | |  __/ |_
+ *       \____/| .__/ \___|_| |_|_|  |_|\___/|_|  |_| |_|\___|\__|
+ *             | |
+ *             |_|
+ *   ----------------------------------------------------------------------------------
+ *
+ * @file      Benchmark.cpp
+ * @author    Ulukaii
+ * @date      17.10.2026
+ * @version   t 0.4.0
+ * @copyright Copyright 2016-2026 OpenHornet. See 2A13-BACKLIGHT_CONTROLLER.ino for details.
+ * @brief     Host benchmark of the backlight controller: replays a scripted sequence of dimmer and indicator changes.
+ * @details   Each step of the script is one DCS-BIOS export frame (30 per second). After the frame's writes, loop()
+ *            runs until the next frame, on simulated time. Per phase, the benchmark reports:
+ *            - ns/update:    host time spent in loop() from the frame's writes to its last LED output
+ *            - shows/change: controller outputs (FastLED showLeds() calls) per frame with a change
+ *            - LEDs/change:  LEDs pushed to the strips per frame with a change
+ *            - peak LEDs:    most LEDs pushed for a single frame
+ *            - max latency:  simulated time from a frame's writes to its last LED output
+ *            Between the phases, the backlight fade of the last phase is run out and reported separately. The
+ *            benchmark ends with idle frames and a full instrument dimmer jump after two idle seconds, which must
+ *            fade over RAMP_MS instead of being applied at once. Finally, all dimmers and caution lights are turned
+ *            full on, and the lowest output brightness of every channel is listed with its estimated power, to
+ *            check the power budgets.
+ *            Build and run with "make run" in this directory.
+ *********************************************************************************************************************/
+
+#include <stdio.h>
+#include "HostHarness.h"
+
+const Control INSTR_INT_LT = {FA_18C_hornet_INSTR_INT_LT};
+const Control CONSOLES_DIMMER = {FA_18C_hornet_CONSOLES_DIMMER};
+const Control FLOOD_DIMMER = {FA_18C_hornet_FLOOD_DIMMER};
+const Control MASTER_CAUTION_LT = {FA_18C_hornet_MASTER_CAUTION_LT};
+const Control CAUTION_LIGHTS[] = {
+    {FA_18C_hornet_CLIP_APU_ACC_LT}, {FA_18C_hornet_CLIP_BATT_SW_LT}, {FA_18C_hornet_CLIP_CK_SEAT_LT},
+    {FA_18C_hornet_CLIP_FCES_LT}, {FA_18C_hornet_CLIP_FCS_HOT_LT}, {FA_18C_hornet_CLIP_FUEL_LO_LT},
+    {FA_18C_hornet_CLIP_GEN_TIE_LT}, {FA_18C_hornet_CLIP_L_GEN_LT}, {FA_18C_hornet_CLIP_R_GEN_LT}
+};
+const Control JETT_LIGHTS[] = {
+    {FA_18C_hornet_SJ_CTR_LT}, {FA_18C_hornet_SJ_LI_LT}, {FA_18C_hornet_SJ_LO_LT},
+    {FA_18C_hornet_SJ_RI_LT}, {FA_18C_hornet_SJ_RO_LT}
+};
+const int CAUTION_COUNT = sizeof(CAUTION_LIGHTS) / sizeof(CAUTION_LIGHTS[0]);
+const int JETT_COUNT = sizeof(JETT_LIGHTS) / sizeof(JETT_LIGHTS[0]);
+
+/**
+ * @brief Results of one phase of the script
+ */
+struct PhaseStats {
+    unsigned long changedFrames = 0;
+    uint64_t updateNs = 0;
+    unsigned long shows = 0;
+    unsigned long leds = 0;
+    unsigned long peakLeds = 0;
+    uint32_t maxLatencyUs = 0;
+};
+
+ExportState dcs;
+uint8_t lowestBrightness[CFastLED::MAX_CONTROLLERS];                 // Lowest output brightness per controller
+uint32_t lastPower_mW[CFastLED::MAX_CONTROLLERS];                     // Estimate of the last output, FastLED's model
+
+/**
+ * @brief Records the output brightness and power of every show
+ */
+void onShow(const CLEDController& controller) {
+    int i = &controller - &FastLED[0];
+    lowestBrightness[i] = min(lowestBrightness[i], controller.lastBrightness);
+    uint32_t power = 0;
+    for (const CRGB& c : controller.shown) power += (c.r * 16U + c.g * 11U + c.b * 15U) * 5U / 255U + 5U;
+    lastPower_mW[i] = power * controller.lastBrightness / 255U;
+}
+
+/**
+ * @brief Ends the current export frame and runs loop() until the next one
+ * @param stats Phase results to add this frame to
+ * @param changed True if the frame contained writes
+ */
+void runFrame(PhaseStats& stats, bool changed) {
+    dcs.endFrame();
+    uint32_t frameStart = hostMicros;
+    unsigned long shows = totalShows();
+    unsigned long leds = totalLeds();
+    uint64_t ns = 0;
+    uint64_t nsToLastShow = 0;
+    uint32_t lastShowUs = frameStart;
+    while (hostMicros - frameStart < FRAME_US) {
+        unsigned long before = totalShows();
+        ns += runLoop();
+        if (totalShows() != before) {
+            nsToLastShow = ns;
+            lastShowUs = hostMicros;
+        }
+    }
+    if (!changed) return;
+    unsigned long frameLeds = totalLeds() - leds;
+    stats.changedFrames++;
+    stats.updateNs += nsToLastShow;
+    stats.shows += totalShows() - shows;
+    stats.leds += frameLeds;
+    stats.peakLeds = max(stats.peakLeds, frameLeds);
+    stats.maxLatencyUs = max(stats.maxLatencyUs, lastShowUs - frameStart);
+}
+
+/**
+ * @brief Runs export frames without writes until the backlight fades of the last phase have ended
+ * @details Keeps the fade of one phase out of the shows and latencies of the next one.
+ * @param tail Phase results to add the fade frames to
+ */
+void settle(PhaseStats& tail) {
+    for (int i = 0; i < 30; i++) {                                   // A fade ends within RAMP_MS (one second at most)
+        unsigned long shows = totalShows();
+        unsigned long leds = totalLeds();
+        runFrame(tail, false);
+        if (totalShows() == shows) return;
+        tail.changedFrames++;
+        tail.shows += totalShows() - shows;
+        tail.leds += totalLeds() - leds;
+    }
+}
+
+void report(const char* name, const PhaseStats& stats) {
+    unsigned long n = stats.changedFrames ? stats.changedFrames : 1;
+    printf("%-28s %6lu %10llu %12.1f %11lu %10lu %14lu\n", name, stats.changedFrames,
+           (unsigned long long)(stats.updateNs / n), (double)stats.shows / n, stats.leds / n, stats.peakLeds,
+           (unsigned long)stats.maxLatencyUs);
+}
+
+int main() {
+    CLEDController::showHook = onShow;
+    setup();
+
+    PhaseStats warmUp;                                                // Let the sketch see DCS running, set start levels
+    for (int i = 0; i < 30; i++) {
+        if (i == 0) {
+            dcs.set(INSTR_INT_LT, 40000);
+            dcs.set(CONSOLES_DIMMER, 40000);
+        }
+        runFrame(warmUp, i == 0);
+    }
+    PhaseStats tail;
+    settle(tail);
+
+    printf("%-28s %6s %10s %12s %11s %10s %14s\n", "phase", "frames", "ns/update", "shows/change", "LEDs/change",
+           "peak LEDs", "max latency us");
+
+    PhaseStats instr;
+    for (int i = 0; i < 64; i++) {
+        dcs.set(INSTR_INT_LT, 65535 - i * 1024);
+        runFrame(instr, true);
+    }
+    report("instrument dimmer sweep", instr);
+    settle(tail);
+
+    PhaseStats console;
+    for (int i = 0; i < 64; i++) {
+        dcs.set(CONSOLES_DIMMER, 65535 - i * 1024);
+        runFrame(console, true);
+    }
+    report("console dimmer sweep", console);
+    settle(tail);
+
+    PhaseStats flood;
+    for (int i = 0; i < 64; i++) {
+        dcs.set(FLOOD_DIMMER, i * 1024);
+        runFrame(flood, true);
+    }
+    report("flood dimmer sweep", flood);
+    settle(tail);
+
+    PhaseStats caution;
+    for (int i = 0; i < 4 * CAUTION_COUNT; i++) {
+        dcs.set(CAUTION_LIGHTS[i % CAUTION_COUNT], (i / CAUTION_COUNT) % 2 == 0);
+        runFrame(caution, true);
+    }
+    report("caution light toggles", caution);
+    settle(tail);
+
+    PhaseStats masterCaution;
+    for (int i = 0; i < 32; i++) {
+        dcs.set(MASTER_CAUTION_LT, i % 2 == 0);
+        runFrame(masterCaution, true);
+    }
+    report("master caution flashing", masterCaution);
+    settle(tail);
+
+    PhaseStats mixed;
+    for (int i = 0; i < 64; i++) {
+        dcs.set(MASTER_CAUTION_LT, i % 2 == 0);
+        dcs.set(JETT_LIGHTS[i % JETT_COUNT], (i / JETT_COUNT) % 2 == 0);
+        dcs.set(INSTR_INT_LT, 20000 + i * 512);
+        runFrame(mixed, true);
+    }
+    report("mixed indicators + dimmer", mixed);
+    settle(tail);
+
+    PhaseStats idle;
+    unsigned long idleShows = totalShows();
+    for (int i = 0; i < 64; i++) runFrame(idle, false);
+    idleShows = totalShows() - idleShows;
+
+    PhaseStats jump;                                                  // Full dimmer jump after idle must fade, not cut
+    dcs.set(INSTR_INT_LT, 0);
+    runFrame(jump, false);
+    settle(jump);
+    for (int i = 0; i < 60; i++) runFrame(idle, false);               // Two seconds without changes
+    jump = PhaseStats();
+    dcs.set(INSTR_INT_LT, 65535);
+    runFrame(jump, true);
+    settle(jump);
+
+    printf("fade tails between phases: %lu shows in %lu frames\n", tail.shows, tail.changedFrames);
+    printf("idle frames: %lu shows in 64 frames\n", idleShows);
+    printf("instrument jump after idle: faded over %lu frames\n", jump.changedFrames);
+
+    PhaseStats full;
+    for (int i = 0; i < FastLED.count(); i++) lowestBrightness[i] = 255;
+    dcs.set(INSTR_INT_LT, 65535);
+    dcs.set(CONSOLES_DIMMER, 65535);
+    dcs.set(FLOOD_DIMMER, 65535);
+    for (int i = 0; i < CAUTION_COUNT; i++) dcs.set(CAUTION_LIGHTS[i], 1);
+    runFrame(full, true);
+    settle(full);
+    uint32_t total_mW = 0;
+    printf("all full on, per pin: lowest brightness / power");
+    for (int i = 0; i < FastLED.count(); i++) {
+        printf(" %d:%d/%.1fW", FastLED[i].pin, lowestBrightness[i], lastPower_mW[i] / 1000.0);
+        total_mW += lastPower_mW[i];
+    }
+    printf(", total %.1fW\n", total_mW / 1000.0);
+    return 0;
+}
@@ -0,0 +1,115 @@
+/**********************************************************************************************************************
+ *        ____                   _    _                       _
+ *       / __ \                 | |  | |                     | |
+ *      | |  | |_ __   ___ _ __ | |__| | ___  _ __ _ __   ___| |_
+ *      | |  | | '_ \ / _ \ '_ \|  __  |/ _ \| '__| '_ \ / _ \ __|
+ *      | |__| | |_) |  __/ | | | |  | | (_) | |  | | | |  __/ |_
+ *       \____/| .__/ \___|_| |_|_|  |_|\___/|_|  |_| |_|\___|\__|
+ *             | |
+ *             |_|
+ *   ----------------------------------------------------------------------------------
+ *
+ * @file      HostHarness.h
+ * @author    Ulukaii
+ * @date      17.10.2026
+ * @version   t 0.4.0
+ * @copyright Copyright 2016-2026 OpenHornet. See 2A13-BACKLIGHT_CONTROLLER.ino for details.
+ * @brief     Helpers shared by the host programs that drive the backlight sketch.
+ * @details   - Control:     one DCS-BIOS export control, built from the FA_18C_hornet_... "address, mask, shift" macros
+ *            - ExportState: the 16-bit export words as the sim would send them; the first set() of a frame sends
+ *                           the frame sync, set() changes a control's bits and writes the whole word, endFrame()
+ *                           writes the update counter at 0xfffe
+ *            - runLoop():   calls the sketch's loop() once, advancing the simulated clock by the time a loop takes
+ *                           on the Mega and measuring the host time spent in it
+ *            - totalShows() / totalLeds(): output counters summed over all FastLED controllers
+ *            The sketch is compiled as its own translation unit; host programs only see setup() and loop() and
+ *            observe it through the stubs.
+ *********************************************************************************************************************/
+
+#ifndef __HOST_HARNESS_H
+#define __HOST_HARNESS_H
+
+#include <Arduino.h>
+#include <chrono>
+#include <map>
+#include "FastLED.h"
+#include "DcsBios.h"
+
+void setup();                                                         // Provided by 2A13-BACKLIGHT_CONTROLLER.ino
+void loop();
+
+const uint32_t LOOP_US = 100;                                         // Simulated duration of one loop() without output
+const uint32_t FRAME_US = 33333;                                      // DCS-BIOS export rate: 30 frames per second
+const uint16_t UPDATE_COUNTER_ADDRESS = 0xfffe;                       // Written last in every export frame
+
+struct Control {
+    uint16_t address;
+    uint16_t mask;
+    uint8_t  shift;
+};
+
+/**
+ * @brief Export words as the sim sends them: controls sharing a word are always written together
+ */
+class ExportState {
+public:
+    /**
+     * @brief Sets one control and writes its whole word to the sketch
+     */
+    void set(const Control& control, uint16_t value) {
+        startFrame();
+        uint16_t& word = words[control.address];
+        word = (word & ~control.mask) | ((value << control.shift) & control.mask);
+        DcsBios::hostWrite(control.address, word);
+    }
+
+    /**
+     * @brief Ends the export frame: writes the update counter
+     */
+    void endFrame() {
+        startFrame();                                                 // A frame without changes still has its sync
+        counter++;
+        DcsBios::hostWrite(UPDATE_COUNTER_ADDRESS, counter & 0x00ff);
+        inFrame = false;
+    }
+
+private:
+    /**
+     * @brief Sends the frame sync (four 0x55 bytes on the wire) before the first write of a frame
+     */
+    void startFrame() {
+        if (inFrame) return;
+        DcsBios::hostFrameSync();
+        inFrame = true;
+    }
+
+    bool inFrame = false;
+    std::map<uint16_t, uint16_t> words;
+    uint16_t counter = 0;
+};
+
+inline unsigned long totalShows() {
+    unsigned long shows = 0;
+    for (int i = 0; i < FastLED.count(); i++) shows += FastLED[i].shows;
+    return shows;
+}
+
+inline unsigned long totalLeds() {
+    unsigned long leds = 0;
+    for (int i = 0; i < FastLED.count(); i++) leds += FastLED[i].ledsOut;
+    return leds;
+}
+
+/**
+ * @brief Runs the sketch's loop() once
+ * @return Host time spent in loop(), in nanoseconds
+ */
+inline uint64_t runLoop() {
+    auto start = std::chrono::steady_clock::now();
+    loop();
+    auto end = std::chrono::steady_clock::now();
+    hostMicros += LOOP_US;                                            // LED output time is added by the FastLED stub
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+
+#endif
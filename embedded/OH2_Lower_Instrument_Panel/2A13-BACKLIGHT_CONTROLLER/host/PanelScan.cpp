@@ -0,0 +1,122 @@
+/**********************************************************************************************************************
+ *        ____                   _    _                       _
+ *       / __ \                 | |  | |                     | |
+ *      | |  | |_ __   ___ _ __ | |__| | ___  _ __ _ __   ___| |_
+ *      | |  | | '_ \ / _ \ '_ \|  __  |/ _ \| '__| '_ \ / _ \ __|
+ *      | |__| | |_) |  __/ | | | |  | | (_) | |  | | | |  __/ |_
+ *       \____/| .__/ \___|_| |_|_|  |_|\___/|_|  |_| |_|\___|\__|
+ *             | |
+ *             |_|
+ *   ----------------------------------------------------------------------------------
+ *
+ * @file      PanelScan.cpp
+ * @author    Ulukaii
+ * @date      17.10.2026
+ * @version   t 0.4.0
+ * @copyright Copyright 2016-2026 OpenHornet. See 2A13-BACKLIGHT_CONTROLLER.ino for details.
+ * @brief     Host run of the panel benchmark: former per-LED table scan against the current run tables.
+ * @details   Runs the cases of helpers/PanelBenchmark/PanelBenchmark.ino with the same panels, tables and channel
+ *            setup, and reports host nanoseconds per update instead of Mega cycles. The ratio between baseline and
+ *            runs is what carries over; the absolute Mega numbers come from the sketch.
+ *            Build and run with "make panels" in this directory.
+ *********************************************************************************************************************/
+
+#include <Arduino.h>
+#include <chrono>
+#include <stdio.h>
+#include "FastLED.h"
+#include "DcsBios.h"
+#include "../helpers/Panel.h"
+#include "../helpers/Channel.h"
+#include "../panels/1A4_L_EWI.h"
+#include "../panels/5A3A1_CAUTION.h"
+#include "../panels/2A2A1A1_Jett_Station_Panel.h"
+#include "../panels/5A5_RC2_ALL_PANELS.h"
+#include "../helpers/PanelBenchmark/BaselineTable.h"
+
+const int RUNS = 100000;                                              // Number of runs averaged per measurement
+
+uint8_t ewiLeds[L_EWI_LED_COUNT];
+uint8_t rc1Leds[CAUTION_LED_COUNT];
+uint8_t lipLeds[JETT_STATION_LED_COUNT];
+uint8_t rc2Leds[RC2_ALL_PANELS_LED_COUNT];
+CRGB outputLeds[RC2_ALL_PANELS_LED_COUNT];
+CRGB baselineStrip[RC2_ALL_PANELS_LED_COUNT];
+
+Channel UIP_1(11, "Channel 3", ewiLeds, L_EWI_LED_COUNT);
+Channel RC_1(7, "Channel 7", rc1Leds, CAUTION_LED_COUNT);
+Channel LIP_1(13, "Channel 1", lipLeds, JETT_STATION_LED_COUNT);
+Channel RC_2(6, "Channel 8", rc2Leds, RC2_ALL_PANELS_LED_COUNT);
+
+typedef BaselineTable<lEwiLedRuns, sizeof(lEwiLedRuns) / sizeof(LedRun), L_EWI_LED_COUNT> EwiBaseline;
+typedef BaselineTable<cautionLedRuns, sizeof(cautionLedRuns) / sizeof(LedRun), CAUTION_LED_COUNT> CautionBaseline;
+typedef BaselineTable<jettStationLedRuns, sizeof(jettStationLedRuns) / sizeof(LedRun), JETT_STATION_LED_COUNT>
+    JettStationBaseline;
+typedef BaselineTable<rc2AllPanelsLedRuns, sizeof(rc2AllPanelsLedRuns) / sizeof(LedRun), RC2_ALL_PANELS_LED_COUNT>
+    Rc2Baseline;
+
+/**
+ * @brief Gives the benchmark access to the protected Panel update methods
+ */
+struct PanelAccess : Panel {
+    static void setIndicator(Panel* p, LedRole role, const CRGB& color) {
+        (p->*(&PanelAccess::setIndicatorColor))(role, color);
+    }
+    static void setConsole(Panel* p, uint16_t value) {
+        (p->*(&PanelAccess::setConsoleLights))(value, NVIS_GREEN_A);
+    }
+};
+
+/**
+ * @brief Runs an update RUNS times and returns the average time of one update in nanoseconds
+ */
+template<typename Update>
+double timeNs(Update update) {
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < RUNS; r++) update(r);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / (double)RUNS;
+}
+
+void report(const char* name, size_t baselineBytes, double baseline, size_t runBytes, double runs) {
+    printf("%-40s %8.1f %8zu %8.1f %8zu %7.1fx\n", name, baseline, baselineBytes, runs, runBytes, baseline / runs);
+}
+
+void benchIndicator(const char* name, const BaselineLed* table, Panel* p, LedRole role, const CRGB& color) {
+    double baseline = timeNs([&](int r) {
+        baselineSetRole(table, p->getLedCount(), p->getStartIndex(), baselineStrip, role, (r & 1) ? color : NVIS_BLACK);
+        LedUpdateState::getInstance()->setUpdateFlag(true);
+    });
+    double runs = timeNs([&](int r) { PanelAccess::setIndicator(p, role, (r & 1) ? color : NVIS_BLACK); });
+    report(name, p->getLedCount() * sizeof(BaselineLed), baseline, p->getRunCount() * sizeof(LedRun), runs);
+}
+
+int main() {
+    Channel::setOutputBuffer(outputLeds, RC2_ALL_PANELS_LED_COUNT);
+    UIP_1.initialize();
+    RC_1.initialize();
+    LIP_1.initialize();
+    RC_2.initialize();
+    UIP_1.addPanel<EwiPanel>();
+    RC_1.addPanel<CautionPanel>();
+    LIP_1.addPanel<JettStationPanel>();
+    RC_2.addPanel<Rc2AllPanels>();
+
+    printf("%-40s %8s %8s %8s %8s %8s\n", "ns per update", "baseline", "flash", "runs", "flash", "speedup");
+    benchIndicator("L EWI master caution", EwiBaseline::leds, UIP_1.getPanel(0), LED_CAUTION, NVIS_YELLOW);
+    benchIndicator("Caution panel FUEL LO", CautionBaseline::leds, RC_1.getPanel(0), LED_FUEL_LO, NVIS_YELLOW);
+    benchIndicator("Jett station LO", JettStationBaseline::leds, LIP_1.getPanel(0), LED_JETT_LO_1, NVIS_WHITE);
+    benchIndicator("RC2 all panels (349 LEDs) console role", Rc2Baseline::leds, RC_2.getPanel(0), LED_CONSOLE_BL,
+                   NVIS_GREEN_A);
+
+    double baseline = timeNs([](int r) {
+        CRGB target = NVIS_GREEN_A;
+        target.nscale8_video(map((r & 0xff) * 256, 0, 65535, 0, 255));
+        baselineSetRole(Rc2Baseline::leds, RC2_ALL_PANELS_LED_COUNT, 0, baselineStrip, LED_CONSOLE_BL, target);
+        LedUpdateState::getInstance()->setUpdateFlag(true);
+    });
+    double runs = timeNs([](int r) { PanelAccess::setConsole(RC_2.getPanel(0), (r & 0xff) * 256); });
+    report("RC2 setConsoleLights incl. scaling", RC2_ALL_PANELS_LED_COUNT * sizeof(BaselineLed), baseline,
+           RC_2.getPanel(0)->getRunCount() * sizeof(LedRun), runs);
+    return 0;
+}
@@ -0,0 +1,359 @@
+/**********************************************************************************************************************
+ *        ____                   _    _                       _
+ *       / __ \                 | |  | |                     | |
+ *      | |  | |_ __   ___ _ __ | |__| | ___  _ __ _ __   ___| |_
+ *      | |  | | '_ \ / _ \ '_ \|  __  |/ _ \| '__| '_ \ / _ \ __|
+ *      | |__| | |_) |  __/ | | | |  | | (_) | |  | | | |  __/ |_
+ *       \____/| .__/ \___|_| |_|_|  |_|\___/|_|  |_| |_|\___|\__|
+ *             | |
+ *             |_|
+ *   ----------------------------------------------------------------------------------
+ *
+ * @file      Replay.cpp
+ * @author    Ulukaii
+ * @date      17.10.2026
+ * @version   t 0.4.0
+ * @copyright Copyright 2016-2026 OpenHornet. See 2A13-BACKLIGHT_CONTROLLER.ino for details.
+ * @brief     Replays a DCS-BIOS export stream capture through the sketch and measures end-to-end lighting latency.
+ * @details   The capture is the raw export stream, as DCS-BIOS sends it over UDP multicast (239.255.50.10:5010) or
+ *            the serial port. Its bytes are fed to the DCS-BIOS protocol parser on simulated time:
+ *            - every byte takes 40 us on the wire (250 kbaud, 10 bits per byte)
+ *            - a frame (starting with four 0x55 sync bytes) starts every 33.3 ms, or right after the previous one
+ *              if that took longer to send
+ *            - bytes are delivered before each loop() once their arrival time has passed
+ *            For every write that changes an export word, the replay records:
+ *            - callback latency: from the arrival of its last byte to the loop() pass that runs the callbacks
+ *            - LED latency:      from the arrival of its last byte to the end of the first show() after that
+ *                                pass that changes what a strip displays
+ *            It also reports the longest window in which the RX interrupt could not run (interrupts off or RXCIE0
+ *            masked, see the Arduino stub) and the bytes that would have been lost in such windows: the UART holds two
+ *            received bytes, so every further byte arriving within one window overruns it.
+ *            Changes that do not make any LED change (e.g. a dimmer step too small to change the LED brightness) are
+ *            counted but not added to the LED histogram: either an output burst that started after their callbacks
+ *            showed no change, or no output started within one export frame.
+ *            Both are printed as a histogram with 1 ms buckets; with a second argument, the histogram is also
+ *            written as CSV, so that runs with different frame pacing settings can be compared on the same capture.
+ *
+ *            Usage: replay <capture> [histogram.csv]
+ *                   replay --synthesize <capture>   writes a 60 s demo capture using the host build's addresses
+ *
+ *            A capture of a real flight can be recorded with e.g.
+ *                socat -u UDP4-RECV:5010,reuseaddr,ip-add-membership=239.255.50.10:0.0.0.0 CREATE:flight.dcsbios
+ *            and needs the real export addresses (make DCSBIOS_ADDRESSES=...).
+ *********************************************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include "HostHarness.h"
+
+const uint32_t BYTE_US = 40;                                          // 10 bits at 250 kbaud
+const int BUCKETS = 50;                                               // 1 ms buckets, the last one collects the rest
+const long RX_BUFFER_BYTES = 2;                                       // Received bytes the Mega's UART holds
+
+/**
+ * @brief One changed export word on its way to the LEDs
+ */
+struct Change {
+    uint32_t arrivalUs;
+    uint32_t callbackUs;
+};
+
+/**
+ * @brief What a strip displayed at its last output
+ */
+struct Output {
+    std::vector<CRGB> leds;
+    uint8_t brightness = 0;
+};
+
+DcsBios::ProtocolParser parser;
+std::map<uint16_t, uint16_t> words;                                   // Last value of every export word
+std::vector<Change> arrived;                                          // Written, callbacks not yet run
+std::vector<Change> awaitingShow;                                     // Callbacks run, no LED change yet
+std::map<uint8_t, Output> lastShown;                                  // Last output per data pin
+bool inBurst = false;                                                 // Loops with output since the last idle loop
+uint32_t burstStartUs = 0;                                            // Start of the first output of the burst
+int showsThisLoop = 0;
+uint32_t lastFrameEndUs = 0;                                          // Arrival of the last update counter write
+uint32_t byteArrivalUs = 0;                                           // Arrival time of the byte being parsed
+const std::vector<uint32_t>* byteArrivals = nullptr;                  // Arrival time of every byte of the capture
+uint32_t maxRxHeldUs = 0;                                             // Longest window without RX interrupt
+unsigned long rxBytesLost = 0;                                        // Bytes that would have overrun the UART
+
+unsigned long changes = 0;
+unsigned long invisibleChanges = 0;
+unsigned long callbackHistogram[BUCKETS] = {0};
+unsigned long ledHistogram[BUCKETS] = {0};
+std::vector<uint32_t> callbackLatencies;
+std::vector<uint32_t> ledLatencies;
+
+void record(unsigned long* histogram, std::vector<uint32_t>& latencies, uint32_t us) {
+    histogram[min(us / 1000, (uint32_t)(BUCKETS - 1))]++;
+    latencies.push_back(us);
+}
+
+/**
+ * @brief Records a window in which the RX interrupt could not run
+ */
+void onRxHeld(uint32_t fromUs, uint32_t toUs) {
+    maxRxHeldUs = max(maxRxHeldUs, toUs - fromUs);
+    if (!byteArrivals) return;
+    long bytes = std::upper_bound(byteArrivals->begin(), byteArrivals->end(), toUs) -
+                 std::upper_bound(byteArrivals->begin(), byteArrivals->end(), fromUs);
+    if (bytes > RX_BUFFER_BYTES) rxBytesLost += bytes - RX_BUFFER_BYTES;
+}
+
+/**
+ * @brief Drops the changes that caused no output at all
+ * @details Called at the end of every export frame. The board commits a frame at its end, at the latest after its
+ *          maximum latency; a change still without output one whole export frame later did not change any LED.
+ */
+void endExportFrame() {
+    size_t kept = 0;
+    for (const Change& c : awaitingShow) {
+        bool noOutput = (int32_t)(c.callbackUs - lastFrameEndUs) < 0 && (int32_t)(burstStartUs - c.callbackUs) < 0;
+        if (noOutput) invisibleChanges++;
+        else awaitingShow[kept++] = c;
+    }
+    awaitingShow.resize(kept);
+    lastFrameEndUs = byteArrivalUs;
+}
+
+void onWrite(unsigned int address, unsigned int value) {
+    if (address == UPDATE_COUNTER_ADDRESS) {
+        endExportFrame();
+        return;
+    }
+    auto word = words.find(address);
+    if (word != words.end() && word->second == value) return;         // DCS-BIOS resends unchanged words
+    words[address] = value;
+    arrived.push_back({byteArrivalUs, 0});
+    changes++;
+}
+
+void onLoop() {
+    for (Change& c : arrived) {
+        c.callbackUs = hostMicros;
+        record(callbackHistogram, callbackLatencies, c.callbackUs - c.arrivalUs);
+        awaitingShow.push_back(c);
+    }
+    arrived.clear();
+}
+
+void onShow(const CLEDController& controller) {
+    uint32_t startUs = hostMicros - CLEDController::WIRE_US_PER_LED * controller.count;
+    if (!inBurst) burstStartUs = startUs;
+    inBurst = true;
+    showsThisLoop++;
+    Output& last = lastShown[controller.pin];
+    bool changed = last.brightness != controller.lastBrightness || last.leds.size() != controller.shown.size();
+    for (size_t i = 0; !changed && i < last.leds.size(); i++) {
+        changed = last.leds[i].r != controller.shown[i].r || last.leds[i].g != controller.shown[i].g ||
+                  last.leds[i].b != controller.shown[i].b;
+    }
+    last.leds = controller.shown;
+    last.brightness = controller.lastBrightness;
+    if (!changed) return;
+    for (const Change& c : awaitingShow) record(ledHistogram, ledLatencies, hostMicros - c.arrivalUs);
+    awaitingShow.clear();
+}
+
+/**
+ * @brief Drops the changes that an output burst started after their callbacks did not make visible
+ * @details The board outputs the dirty channels of a frame in consecutive loops; a loop without output ends the
+ *          burst. A change whose callback ran before the burst started would have been part of it.
+ */
+void endBurst() {
+    if (showsThisLoop) {
+        showsThisLoop = 0;
+        return;
+    }
+    if (!inBurst) return;
+    inBurst = false;
+    size_t kept = 0;
+    for (const Change& c : awaitingShow) {
+        if ((int32_t)(burstStartUs - c.callbackUs) >= 0) invisibleChanges++;
+        else awaitingShow[kept++] = c;
+    }
+    awaitingShow.resize(kept);
+}
+
+/**
+ * @brief Computes the arrival time of every byte of the capture
+ */
+std::vector<uint32_t> scheduleBytes(const std::vector<uint8_t>& capture, uint32_t startUs, unsigned long& frames) {
+    std::vector<uint32_t> arrival(capture.size());
+    uint32_t t = startUs;
+    int syncBytes = 0;
+    frames = 0;
+    for (size_t i = 0; i < capture.size(); i++) {
+        if (syncBytes == 0 && i + 3 < capture.size() && capture[i] == 0x55 && capture[i + 1] == 0x55 &&
+            capture[i + 2] == 0x55 && capture[i + 3] == 0x55) {
+            uint32_t frameStart = startUs + frames * FRAME_US;
+            if ((int32_t)(frameStart - t) > 0) t = frameStart;
+            frames++;
+        }
+        syncBytes = (capture[i] == 0x55) ? (syncBytes + 1) % 4 : 0;
+        t += BYTE_US;
+        arrival[i] = t;
+    }
+    return arrival;
+}
+
+uint32_t percentile(std::vector<uint32_t> latencies, int p) {
+    if (latencies.empty()) return 0;
+    std::sort(latencies.begin(), latencies.end());
+    return latencies[(latencies.size() - 1) * p / 100];
+}
+
+void printSummary(const char* name, const std::vector<uint32_t>& latencies) {
+    printf("%-18s n=%-7lu p50=%-6lu p90=%-6lu p99=%-6lu max=%lu us\n", name, (unsigned long)latencies.size(),
+           (unsigned long)percentile(latencies, 50), (unsigned long)percentile(latencies, 90),
+           (unsigned long)percentile(latencies, 99), (unsigned long)percentile(latencies, 100));
+}
+
+void printHistogram(FILE* csv) {
+    printf("\n%5s %10s %10s\n", "ms", "callback", "LED");
+    if (csv) fprintf(csv, "bucket_ms,callback,led\n");
+    for (int b = 0; b < BUCKETS; b++) {
+        if (callbackHistogram[b] || ledHistogram[b]) {
+            printf("%4d%s %10lu %10lu\n", b, b == BUCKETS - 1 ? "+" : " ", callbackHistogram[b], ledHistogram[b]);
+        }
+        if (csv) fprintf(csv, "%d,%lu,%lu\n", b, callbackHistogram[b], ledHistogram[b]);
+    }
+}
+
+int replay(const char* capturePath, const char* csvPath) {
+    FILE* f = fopen(capturePath, "rb");
+    if (!f) {
+        perror(capturePath);
+        return 1;
+    }
+    std::vector<uint8_t> capture;
+    int c;
+    while ((c = fgetc(f)) != EOF) capture.push_back((uint8_t)c);
+    fclose(f);
+
+    setup();
+    DcsBios::hostWriteHook = onWrite;
+    DcsBios::hostLoopHook = onLoop;
+    CLEDController::showHook = onShow;
+    for (int i = 0; i < 1000; i++) runLoop();                         // Let the sketch settle on its start-up output
+
+    unsigned long frames;
+    std::vector<uint32_t> arrival = scheduleBytes(capture, hostMicros, frames);
+    byteArrivals = &arrival;
+    hostRxHeldHook = onRxHeld;
+    size_t next = 0;
+    while (next < capture.size() || !arrived.empty() || inBurst) {
+        while (next < capture.size() && (int32_t)(hostMicros - arrival[next]) >= 0) {
+            byteArrivalUs = arrival[next];
+            parser.processChar(capture[next++]);
+        }
+        runLoop();
+        endBurst();
+    }
+
+    printf("replayed %lu bytes in %lu frames (%.1f s), %lu changed words, %lu without visible LED change\n\n",
+           (unsigned long)capture.size(), frames, frames * FRAME_US / 1e6, changes, invisibleChanges);
+    printSummary("byte -> callback", callbackLatencies);
+    printSummary("byte -> LED", ledLatencies);
+    printf("RX interrupt held off: max %lu us (budget %lu us), %lu bytes would overrun the UART\n",
+           (unsigned long)maxRxHeldUs, (unsigned long)(RX_BUFFER_BYTES * BYTE_US), rxBytesLost);
+
+    FILE* csv = nullptr;
+    if (csvPath && !(csv = fopen(csvPath, "w"))) {
+        perror(csvPath);
+        return 1;
+    }
+    printHistogram(csv);
+    if (csv) fclose(csv);
+    return 0;
+}
+
+/**
+ * @brief Builds export frames in the DCS-BIOS wire format
+ */
+class CaptureWriter {
+public:
+    void set(const Control& control, uint16_t value) {
+        uint16_t& word = words[control.address];
+        word = (word & ~control.mask) | ((value << control.shift) & control.mask);
+        dirty[control.address] = true;
+    }
+
+    void endFrame(bool fullRefresh) {
+        for (int i = 0; i < 4; i++) bytes.push_back(0x55);
+        for (auto& w : words) {                                       // Written in address order, as DCS-BIOS does
+            if (!fullRefresh && !dirty[w.first]) continue;
+            writeBlock(w.first, w.second);
+        }
+        dirty.clear();
+        writeBlock(UPDATE_COUNTER_ADDRESS, ++counter & 0x00ff);
+    }
+
+    const std::vector<uint8_t>& data() const { return bytes; }
+
+private:
+    void writeWord(uint16_t w) {
+        bytes.push_back(w & 0xff);
+        bytes.push_back(w >> 8);
+    }
+
+    void writeBlock(uint16_t address, uint16_t value) {
+        writeWord(address);
+        writeWord(2);
+        writeWord(value);
+    }
+
+    std::map<uint16_t, uint16_t> words;
+    std::map<uint16_t, bool> dirty;
+    std::vector<uint8_t> bytes;
+    uint16_t counter = 0;
+};
+
+int synthesize(const char* capturePath) {
+    const Control instr = {FA_18C_hornet_INSTR_INT_LT};
+    const Control consoles = {FA_18C_hornet_CONSOLES_DIMMER};
+    const Control flood = {FA_18C_hornet_FLOOD_DIMMER};
+    const Control masterCaution = {FA_18C_hornet_MASTER_CAUTION_LT};
+    const Control cautions[] = {
+        {FA_18C_hornet_CLIP_APU_ACC_LT}, {FA_18C_hornet_CLIP_BATT_SW_LT}, {FA_18C_hornet_CLIP_FUEL_LO_LT},
+        {FA_18C_hornet_CLIP_L_GEN_LT}, {FA_18C_hornet_CLIP_R_GEN_LT}
+    };
+    const Control jett[] = {{FA_18C_hornet_SJ_CTR_LT}, {FA_18C_hornet_SJ_LI_LT}, {FA_18C_hornet_SJ_RI_LT}};
+
+    CaptureWriter w;
+    srand(1);
+    w.set(instr, 40000);
+    w.set(consoles, 40000);
+    for (int frame = 0; frame < 60 * 30; frame++) {
+        if (frame % 15 == 0) w.set(masterCaution, (frame / 15) % 2);  // Flashes at 1 Hz
+        if (frame >= 300 && frame < 364) w.set(instr, 40000 + (frame - 300) * 256);
+        if (frame >= 600 && frame < 664) w.set(consoles, 40000 - (frame - 600) * 256);
+        if (frame >= 900 && frame < 964) w.set(flood, (frame - 900) * 1024);
+        if (rand() % 20 == 0) w.set(cautions[rand() % 5], rand() % 2);
+        if (rand() % 45 == 0) w.set(jett[rand() % 3], rand() % 2);
+        w.endFrame(frame % 30 == 29);                                 // Periodic full refresh, as DCS-BIOS sends
+    }
+
+    FILE* f = fopen(capturePath, "wb");
+    if (!f) {
+        perror(capturePath);
+        return 1;
+    }
+    fwrite(w.data().data(), 1, w.data().size(), f);
+    fclose(f);
+    printf("wrote %lu bytes to %s\n", (unsigned long)w.data().size(), capturePath);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc == 3 && strcmp(argv[1], "--synthesize") == 0) return synthesize(argv[2]);
+    if (argc == 2 || argc == 3) return replay(argv[1], argc == 3 ? argv[2] : nullptr);
+    fprintf(stderr, "usage: %s <capture> [histogram.csv]\n       %s --synthesize <capture>\n", argv[0], argv[0]);
+    return 2;
+}
@@ -0,0 +1,96 @@
+/**********************************************************************************************************************
+ *        ____                   _    _                       _
+ *       / __ \                 | |  | |                     | |
+ *      | |  | |_ __   ___ _ __ | |__| | ___  _ __ _ __   ___| |_
+ *      | |  | | '_ \ / _ \ '_ \|  __  |/ _ \| '__| '_ \ / _ \ __|
+ *      | |__| | |_) |  __/ | | | |  | | (_) | |  | | | |  __/ |_
+ *       \____/| .__/ \___|_| |_|_|  |_|\___/|_|  |_| |_|\___|\__|
+ *             | |
+ *             |_|
+ *   ----------------------------------------------------------------------------------
+ *
+ * @file      SegmentAbort.cpp
+ * @author    Ulukaii
+ * @date      17.10.2026
+ * @version   t 0.4.0
+ * @copyright Copyright 2016-2026 OpenHornet. See 2A13-BACKLIGHT_CONTROLLER.ino for details.
+ * @brief     Host test: a channel whose output is aborted on every try is still shown.
+ * @details   The FastLED stub aborts every output of RC2 (pin 6) while the RX interrupt can run, as sustained
+ *            DCS-BIOS traffic with a too long RX interrupt would. After Board::MAX_SEGMENT_ABORTS (3) aborts in a row,
+ *            the board must output RC2 with the RX interrupt masked. The test reports how long that holds the RX
+ *            interrupt off and how many bytes a busy 250 kbaud line would lose meanwhile.
+ *            Build and run with "make test" in this directory; exits with 1 on failure.
+ *********************************************************************************************************************/
+
+#include <stdio.h>
+#include "HostHarness.h"
+
+const Control CONSOLES_DIMMER = {FA_18C_hornet_CONSOLES_DIMMER};
+const uint8_t RC2_PIN = 6;
+const unsigned long MAX_SEGMENT_ABORTS = 3;                           // Board::MAX_SEGMENT_ABORTS
+const uint32_t BYTE_US = 40;                                          // 10 bits at 250 kbaud
+const uint32_t RX_BUFFER_BYTES = 2;                                   // Received bytes the Mega's UART holds
+
+ExportState dcs;
+bool abortRc2 = false;
+unsigned long rc2ShowsWithRxMasked = 0;
+uint32_t maxRxHeldUs = 0;
+
+bool onAbort(const CLEDController& controller) { return abortRc2 && controller.pin == RC2_PIN; }
+
+void onShow(const CLEDController& controller) {
+    if (controller.pin == RC2_PIN && hostRxHolds > 0) rc2ShowsWithRxMasked++;
+}
+
+void onRxHeld(uint32_t fromUs, uint32_t toUs) { maxRxHeldUs = max(maxRxHeldUs, toUs - fromUs); }
+
+CLEDController* findController(uint8_t pin) {
+    for (int i = 0; i < FastLED.count(); i++) {
+        if (FastLED[i].pin == pin) return &FastLED[i];
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Runs one export frame period: sends the pending frame and runs loop() until the next one
+ */
+void runFrame() {
+    dcs.endFrame();
+    uint32_t start = hostMicros;
+    while (hostMicros - start < FRAME_US) runLoop();
+}
+
+int main() {
+    CLEDController::abortHook = onAbort;
+    CLEDController::showHook = onShow;
+    setup();
+    dcs.set(CONSOLES_DIMMER, 40000);
+    for (int i = 0; i < 60; i++) runFrame();                          // DCS running, fades of the start levels done
+
+    CLEDController* rc2 = findController(RC2_PIN);
+    if (!rc2) {
+        printf("FAIL: no controller on pin %d\n", RC2_PIN);
+        return 1;
+    }
+    unsigned long shows = rc2->shows;
+    abortRc2 = true;
+    hostRxHeldHook = onRxHeld;
+    dcs.set(CONSOLES_DIMMER, 20000);                                  // Recolors RC2: every output try is aborted
+    for (int i = 0; i < 60 && rc2->shows == shows; i++) runFrame();
+
+    bool failed = false;
+    if (rc2->shows == shows) {
+        printf("FAIL: RC2 never shown, %lu outputs aborted\n", rc2->aborts);
+        failed = true;
+    } else if (rc2->aborts != MAX_SEGMENT_ABORTS || rc2ShowsWithRxMasked != 1) {
+        printf("FAIL: RC2 shown after %lu aborts, %lu shows with RX masked (expected %lu and 1)\n", rc2->aborts,
+               rc2ShowsWithRxMasked, MAX_SEGMENT_ABORTS);
+        failed = true;
+    }
+    if (!failed) {
+        printf("PASS: RC2 forced after %lu aborts; RX interrupt held off for %lu us, %lu bytes lost on a busy line\n",
+               rc2->aborts, (unsigned long)maxRxHeldUs,
+               (unsigned long)(maxRxHeldUs / BYTE_US > RX_BUFFER_BYTES ? maxRxHeldUs / BYTE_US - RX_BUFFER_BYTES : 0));
+    }
+    return failed ? 1 : 0;
+}
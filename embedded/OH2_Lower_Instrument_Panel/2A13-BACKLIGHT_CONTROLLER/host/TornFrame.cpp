@@ -0,0 +1,143 @@
+/**********************************************************************************************************************
+ *        ____                   _    _                       _
+ *       / __ \                 | |  | |                     | |
+ *      | |  | |_ __   ___ _ __ | |__| | ___  _ __ _ __   ___| |_
+ *      | |  | | '_ \ / _ \ '_ \|  __  |/ _ \| '__| '_ \ / _ \ __|
+ *      | |__| | |_) |  __/ | | | |  | | (_) | |  | | | |  __/ |_
+ *       \____/| .__/ \___|_| |_|_|  |_|\___/|_|  |_| |_|\___|\__|
+ *             | |
+ *             |_|
+ *   ----------------------------------------------------------------------------------
+ *
+ * @file      TornFrame.cpp
+ * @author    Ulukaii
+ * @date      17.10.2026
+ * @version   t 0.4.0
+ * @copyright Copyright 2016-2026 OpenHornet. See 2A13-BACKLIGHT_CONTROLLER.ino for details.
+ * @brief     Host test: the LEDs never show a partly received DCS-BIOS export frame.
+ * @details   MASTER CAUTION (L EWI) and FUEL LO (caution panel) are always switched together, so any LED state with
+ *            one on and the other off is a torn export frame. While an LED frame is being output, the test delivers
+ *            export frame N+1 (both on) completely, then the sync and the first write of frame N+2 (FUEL LO off,
+ *            the lower address). As the RX interrupt would, all of it reaches the export buffers between two loop()
+ *            passes. The export buffers then hold neither frame, so until frame N+2 is complete, the LEDs must not
+ *            change; after it, they must show N+2.
+ *            Build and run with "make test" in this directory; exits with 1 on failure.
+ *********************************************************************************************************************/
+
+#include <stdio.h>
+#include <vector>
+#include "HostHarness.h"
+
+const Control INSTR_INT_LT = {FA_18C_hornet_INSTR_INT_LT};
+const Control CONSOLES_DIMMER = {FA_18C_hornet_CONSOLES_DIMMER};
+const Control MASTER_CAUTION_LT = {FA_18C_hornet_MASTER_CAUTION_LT};
+const Control CLIP_FUEL_LO_LT = {FA_18C_hornet_CLIP_FUEL_LO_LT};
+
+struct Pixel {
+    int controller;
+    int index;
+};
+
+ExportState dcs;
+
+/**
+ * @brief Runs loop() for the given simulated time
+ */
+void runFor(uint32_t us) {
+    uint32_t start = hostMicros;
+    while (hostMicros - start < us) runLoop();
+}
+
+/**
+ * @brief Runs one export frame period: sends the pending frame and runs loop() until the next one
+ */
+void runFrame() {
+    dcs.endFrame();
+    runFor(FRAME_US);
+}
+
+std::vector<std::vector<CRGB>> snapshot() {
+    std::vector<std::vector<CRGB>> shown;
+    for (int i = 0; i < FastLED.count(); i++) shown.push_back(FastLED[i].shown);
+    return shown;
+}
+
+/**
+ * @brief Finds the LEDs of an indicator by switching it on and comparing the output
+ */
+std::vector<Pixel> findPixels(const Control& indicator) {
+    std::vector<std::vector<CRGB>> before = snapshot();
+    dcs.set(indicator, 1);
+    for (int i = 0; i < 5; i++) runFrame();
+    std::vector<Pixel> pixels;
+    for (int c = 0; c < FastLED.count(); c++) {
+        for (size_t i = 0; i < FastLED[c].shown.size() && i < before[c].size(); i++) {
+            const CRGB& a = before[c][i];
+            const CRGB& b = FastLED[c].shown[i];
+            if (a.r != b.r || a.g != b.g || a.b != b.b) pixels.push_back({c, (int)i});
+        }
+    }
+    dcs.set(indicator, 0);
+    for (int i = 0; i < 5; i++) runFrame();
+    return pixels;
+}
+
+/**
+ * @brief Checks whether the indicator is lit: any of its LEDs is not black
+ * @return 1 if lit, 0 if dark, -1 if only some of its LEDs are lit
+ */
+int lit(const std::vector<Pixel>& pixels) {
+    int on = 0;
+    for (const Pixel& p : pixels) {
+        const CRGB& c = FastLED[p.controller].shown[p.index];
+        if (c.r || c.g || c.b) on++;
+    }
+    return on == 0 ? 0 : on == (int)pixels.size() ? 1 : -1;
+}
+
+int main() {
+    setup();
+    dcs.set(INSTR_INT_LT, 40000);
+    dcs.set(CONSOLES_DIMMER, 40000);
+    for (int i = 0; i < 60; i++) runFrame();                          // DCS running, fades of the start levels done
+
+    std::vector<Pixel> caution = findPixels(MASTER_CAUTION_LT);
+    std::vector<Pixel> fuelLo = findPixels(CLIP_FUEL_LO_LT);
+    if (caution.empty() || fuelLo.empty()) {
+        printf("FAIL: indicator LEDs not found (MASTER CAUTION %zu, FUEL LO %zu)\n", caution.size(), fuelLo.size());
+        return 1;
+    }
+
+    dcs.set(INSTR_INT_LT, 65535);                                     // Frame N: an LED frame over many channels
+    dcs.endFrame();
+    unsigned long shows = totalShows();
+    while (totalShows() == shows) runLoop();                          // First channel out, the others pending
+
+    dcs.set(MASTER_CAUTION_LT, 1);                                    // Frame N+1, complete
+    dcs.set(CLIP_FUEL_LO_LT, 1);
+    dcs.endFrame();
+    dcs.set(CLIP_FUEL_LO_LT, 0);                                      // Frame N+2: sync and first write only
+
+    bool failed = false;
+    uint32_t start = hostMicros;
+    while (hostMicros - start < FRAME_US) {
+        runLoop();
+        int a = lit(caution);
+        int b = lit(fuelLo);
+        if (a != b || a < 0) {
+            printf("FAIL: torn frame shown after %lu us: MASTER CAUTION %d, FUEL LO %d\n",
+                   (unsigned long)(hostMicros - start), a, b);
+            failed = true;
+            break;
+        }
+    }
+
+    dcs.set(MASTER_CAUTION_LT, 0);                                    // Frame N+2 completed
+    runFrame();
+    if (!failed && (lit(caution) != 0 || lit(fuelLo) != 0)) {
+        printf("FAIL: frame N+2 not shown: MASTER CAUTION %d, FUEL LO %d\n", lit(caution), lit(fuelLo));
+        failed = true;
+    }
+    if (!failed) printf("PASS: no torn export frame shown (%zu + %zu indicator LEDs)\n", caution.size(), fuelLo.size());
+    return failed ? 1 : 0;
+}
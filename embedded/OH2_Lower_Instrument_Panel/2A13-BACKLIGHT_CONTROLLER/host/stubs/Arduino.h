@@ -0,0 +1,144 @@
+/**********************************************************************************************************************
+ *        ____                   _    _                       _
+ *       / __ \                 | |  | |                     | |
+ *      | |  | |_ __   ___ _ __ | |__| | ___  _ __ _ __   ___| |_
+ *      | |  | | '_ \ / _ \ '_ \|  __  |/ _ \| '__| '_ \ / _ \ __|
+ *      | |__| | |_) |  __/ | | | |  | | (_) | |  | | | |  __/ |_
+ *       \____/| .__/ \___|_| |_|_|  |_|\___/|_|  |_| |_|\___|\__|
+ *             | |
+ *             |_|
+ *   ----------------------------------------------------------------------------------
+ *
+ * @file      Arduino.h
+ * @author    Ulukaii
+ * @date      17.10.2026
+ * @version   t 0.4.0
+ * @copyright Copyright 2016-2026 OpenHornet. See 2A13-BACKLIGHT_CONTROLLER.ino for details.
+ * @brief     Arduino core shim for the host build of the backlight controller.
+ * @details   Provides the subset of the Arduino core used by the sketch. Time is simulated: millis() and micros()
+ *            read hostMicros, which only advances when the harness or the FastLED stub moves it forward. This makes
+ *            every run deterministic and independent of the host's speed.
+ *            Interrupts do not exist on the host. cli()/sei(), noInterrupts()/interrupts() and clearing RXCIE0 in
+ *            UCSR0B only record the time during which the DCS-BIOS RX interrupt could not run: every such window is
+ *            passed to hostRxHeldHook when it ends, so a host program can count the bytes that would have arrived
+ *            meanwhile. Received bytes are still delivered by the harness, never dropped.
+ *********************************************************************************************************************/
+
+#ifndef __HOST_ARDUINO_H
+#define __HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <string>
+#include <avr/pgmspace.h>
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define LED_BUILTIN 13
+#define F(s) (s)
+#define _BV(bit) (1 << (bit))
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+extern uint32_t hostMicros;                                           // Simulated time in microseconds
+extern uint8_t hostPinLevel[70];                                      // Level read by digitalRead(), per pin
+
+inline unsigned long micros() { return hostMicros; }
+inline unsigned long millis() { return hostMicros / 1000; }
+inline void delay(unsigned long ms) { hostMicros += ms * 1000; }
+inline void delayMicroseconds(unsigned int us) { hostMicros += us; }
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t pin) { return pin < sizeof(hostPinLevel) ? hostPinLevel[pin] : LOW; }
+
+// Direct port access: every pin is its own "port" whose input register is its hostPinLevel entry
+#define digitalPinToPort(pin) (pin)
+#define digitalPinToBitMask(pin) ((uint8_t)1)
+#define portInputRegister(port) ((volatile uint8_t*)&hostPinLevel[port])
+
+extern uint8_t hostRxHolds;                                           // Nesting depth of cli() and RXCIE0 masking
+extern uint32_t hostRxHeldSinceUs;                                    // Start of the current RX hold-off window
+extern void (*hostRxHeldHook)(uint32_t fromUs, uint32_t toUs);        // Called at the end of every window, if set
+
+/**
+ * @brief Starts (hold = true) or ends a window in which the RX interrupt cannot run
+ */
+inline void hostHoldRx(bool hold) {
+    if (hold) {
+        if (hostRxHolds++ == 0) hostRxHeldSinceUs = hostMicros;
+    } else if (hostRxHolds > 0 && --hostRxHolds == 0 && hostRxHeldHook) {
+        hostRxHeldHook(hostRxHeldSinceUs, hostMicros);
+    }
+}
+
+inline void cli() { hostHoldRx(true); }
+inline void sei() { hostHoldRx(false); }
+inline void noInterrupts() { hostHoldRx(true); }
+inline void interrupts() { hostHoldRx(false); }
+
+#define RXCIE0 7                                                      // RX complete interrupt enable bit of UCSR0B
+
+/**
+ * @brief UART control register B: only RXCIE0 is modelled, as an RX hold-off while it is cleared
+ */
+struct HostUartControl {
+    uint8_t value = _BV(RXCIE0);
+
+    HostUartControl& operator&=(int mask) {                         // int, as ~_BV() is
+        if ((value & _BV(RXCIE0)) && !(mask & _BV(RXCIE0))) hostHoldRx(true);
+        value &= mask;
+        return *this;
+    }
+
+    HostUartControl& operator|=(int bits) {
+        if (!(value & _BV(RXCIE0)) && (bits & _BV(RXCIE0))) hostHoldRx(false);
+        value |= bits;
+        return *this;
+    }
+};
+extern HostUartControl hostUCSR0B;
+#define UCSR0B hostUCSR0B
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+template<class T> inline T min(T a, T b) { return a < b ? a : b; }
+template<class T> inline T max(T a, T b) { return a > b ? a : b; }
+#define constrain(x, low, high) ((x) < (low) ? (low) : ((x) > (high) ? (high) : (x)))
+
+/**
+ * @brief Minimal String: only construction from text and numbers, and c_str(), are used by the sketch
+ */
+class String {
+public:
+    String(const char* s) : text(s) {}
+    String(int value) : text(std::to_string(value)) {}
+    String(unsigned int value) : text(std::to_string(value)) {}
+    String(long value) : text(std::to_string(value)) {}
+    String(unsigned long value) : text(std::to_string(value)) {}
+    const char* c_str() const { return text.c_str(); }
+private:
+    std::string text;
+};
+
+/**
+ * @brief Serial port stub; output is discarded, DCS-BIOS traffic is injected through the DcsBios stub instead
+ */
+class HostSerial {
+public:
+    void begin(unsigned long) {}
+    template<class T> void print(T) {}
+    template<class T> void println(T) {}
+    void println() {}
+};
+extern HostSerial Serial;
+
+#endif
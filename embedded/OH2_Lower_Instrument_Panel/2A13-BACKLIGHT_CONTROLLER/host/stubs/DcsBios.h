@@ -0,0 +1,189 @@
+/**********************************************************************************************************************
+ *        ____                   _    _                       _
+ *       / __ \                 | |  | |                     | |
+ *      | |  | |_ __   ___ _ __ | |__| | ___  _ __ _ __   ___| |_
+ *      | |  | | '_ \ / _ \ '_ \|  __  |/ _ \| '__| '_ \ / _ \ __|
+ *      | |__| | |_) |  __/ | | | |  | | (_) | |  | | | |  __/ |_
+ *       \____/| .__/ \___|_| |_|_|  |_|\___/|_|  |_| |_|\___|\__|
+ *             | |
+ *             |_|
+ *   ----------------------------------------------------------------------------------
+ *
+ * @file      DcsBios.h
+ * @author    Ulukaii
+ * @date      17.10.2026
+ * @version   t 0.4.0
+ * @copyright Copyright 2016-2026 OpenHornet. See 2A13-BACKLIGHT_CONTROLLER.ino for details.
+ * @brief     DCS-BIOS stub for the host build of the backlight controller.
+ * @details   Keeps the export listener model of the DCS-BIOS Arduino library: listeners register an address range,
+ *            are kept sorted by address, and get onDcsBiosWrite() for every write inside their range. IntegerBuffer
+ *            stores the masked value and calls its callback from DcsBios::loop() when the value changed.
+ *            There is no serial port: the harness injects writes with DcsBios::hostWrite(), in address order like
+ *            the real export stream, and ends a frame by writing the update counter at 0xfffe. Alternatively, a
+ *            raw export stream (e.g. a capture) can be fed byte by byte to DcsBios::ProtocolParser.
+ *            Optional hooks report each write delivered and each DcsBios::loop() pass (where the callbacks run).
+ *            Messages sent with sendDcsBiosMessage() are counted and handed to an optional hook.
+ *********************************************************************************************************************/
+
+#ifndef __HOST_DCSBIOS_H
+#define __HOST_DCSBIOS_H
+
+#include <Arduino.h>
+#include "DcsBiosAddresses.h"
+
+namespace DcsBios {
+
+class ExportStreamListener {
+public:
+    static ExportStreamListener* first;                               // Listener with the lowest address
+    ExportStreamListener* next;                                       // Next listener in address order
+    unsigned int firstAddressOfInterest;
+    unsigned int lastAddressOfInterest;
+
+    ExportStreamListener(unsigned int firstAddress, unsigned int lastAddress)
+        : firstAddressOfInterest(firstAddress & ~0x01), lastAddressOfInterest(lastAddress & ~0x01) {
+        ExportStreamListener** link = &first;                         // Insert sorted by address, like the library
+        while (*link && (*link)->firstAddressOfInterest <= firstAddressOfInterest) link = &(*link)->next;
+        next = *link;
+        *link = this;
+    }
+    virtual ~ExportStreamListener() {}
+
+    virtual void onDcsBiosWrite(unsigned int, unsigned int) {}
+    virtual void onConsistentData() {}
+    virtual void loop() {}
+
+    static void loopAll() {
+        for (ExportStreamListener* l = first; l; l = l->next) l->loop();
+    }
+};
+
+class IntegerBuffer : public ExportStreamListener {
+public:
+    IntegerBuffer(unsigned int address, unsigned int mask, unsigned char shift, void (*callback)(unsigned int))
+        : ExportStreamListener(address, address), mask(mask), shift(shift), callback(callback) {}
+
+    void onDcsBiosWrite(unsigned int address, unsigned int value) override {
+        if (address != firstAddressOfInterest) return;
+        unsigned int newData = (value & mask) >> shift;
+        if (newData != data) {
+            data = newData;
+            dirty = true;
+        }
+    }
+
+    void loop() override {
+        if (!dirty) return;
+        dirty = false;
+        if (callback) callback(data);
+    }
+
+    unsigned int getData() const { return data; }
+
+private:
+    unsigned int mask;
+    unsigned char shift;
+    void (*callback)(unsigned int);
+    unsigned int data = 0;
+    bool dirty = false;
+};
+
+extern void (*hostWriteHook)(unsigned int address, unsigned int value);   // Called for every write, if set
+extern void (*hostLoopHook)();                                        // Called after every DcsBios::loop(), if set
+
+/**
+ * @brief Delivers one 16-bit export write to every listener whose range covers the address
+ * @param address The DCS-BIOS address
+ * @param value The 16-bit value
+ */
+inline void hostWrite(unsigned int address, unsigned int value) {
+    if (hostWriteHook) hostWriteHook(address, value);
+    for (ExportStreamListener* l = ExportStreamListener::first; l; l = l->next) {
+        if (l->firstAddressOfInterest > address) break;               // Sorted: no later listener can match
+        if (address <= l->lastAddressOfInterest) l->onDcsBiosWrite(address, value);
+    }
+}
+
+/**
+ * @brief Signals the frame sync to all listeners
+ * @details The library calls onConsistentData() when it receives the four sync bytes, i.e. at the start of the next
+ *          export frame; the previous frame ended with the update counter at 0xfffe.
+ */
+inline void hostFrameSync() {
+    for (ExportStreamListener* l = ExportStreamListener::first; l; l = l->next) l->onConsistentData();
+}
+
+/**
+ * @brief Decodes the DCS-BIOS export stream like the library's parser
+ * @details A frame starts with four 0x55 sync bytes, followed by blocks of "address, byte count, data words" (all
+ *          16 bit, little endian). Every data word is delivered with hostWrite().
+ */
+class ProtocolParser {
+public:
+    void processChar(uint8_t c) {
+        switch (state) {
+            case WAIT_FOR_SYNC:
+                break;
+            case ADDRESS_LOW:
+                address = c;
+                state = ADDRESS_HIGH;
+                break;
+            case ADDRESS_HIGH:
+                address |= c << 8;
+                state = (address != 0x5555) ? COUNT_LOW : WAIT_FOR_SYNC;
+                break;
+            case COUNT_LOW:
+                count = c;
+                state = COUNT_HIGH;
+                break;
+            case COUNT_HIGH:
+                count |= c << 8;
+                state = count ? DATA_LOW : ADDRESS_LOW;
+                break;
+            case DATA_LOW:
+                data = c;
+                state = DATA_HIGH;
+                break;
+            case DATA_HIGH:
+                data |= c << 8;
+                hostWrite(address, data);
+                address += 2;
+                count = (count > 2) ? count - 2 : 0;
+                state = count ? DATA_LOW : ADDRESS_LOW;
+                break;
+        }
+        syncBytes = (c == 0x55) ? syncBytes + 1 : 0;
+        if (syncBytes == 4) {                                         // Sync overrides any state, as in the library
+            hostFrameSync();
+            state = ADDRESS_LOW;
+            syncBytes = 0;
+        }
+    }
+
+private:
+    enum State { WAIT_FOR_SYNC, ADDRESS_LOW, ADDRESS_HIGH, COUNT_LOW, COUNT_HIGH, DATA_LOW, DATA_HIGH };
+    State state = WAIT_FOR_SYNC;
+    unsigned int address = 0;
+    unsigned int count = 0;
+    unsigned int data = 0;
+    uint8_t syncBytes = 0;
+};
+
+inline void setup() {}
+inline void loop() {
+    ExportStreamListener::loopAll();
+    if (hostLoopHook) hostLoopHook();
+}
+
+} // namespace DcsBios
+
+extern unsigned long hostMessagesSent;                                // Number of sendDcsBiosMessage() calls
+extern void (*hostMessageHook)(const char* msg, const char* arg);     // Called for every message, if set
+
+inline bool sendDcsBiosMessage(const char* msg, const char* arg) {
+    hostMessagesSent++;
+    if (hostMessageHook) hostMessageHook(msg, arg);
+    return true;
+}
+
+#endif
@@ -0,0 +1,110 @@
+/**********************************************************************************************************************
+ *        ____                   _    _                       _
+ *       / __ \                 | |  | |                     | |
+ *      | |  | |_ __   ___ _ __ | |__| | ___  _ __ _ __   ___| |_
+ *      | |  | | '_ \ / _ \ '_ \|  __  |/ _ \| '__| '_ \ / _ \ __|
+ *      | |__| | |_) |  __/ | | | |  | | (_) | |  | | | |  __/ |_
+ *       \____/| .__/ \___|_| |_|_|  |_|\___/|_|  |_| |_|\___|\__|
+ *             | |
+ *             |_|
+ *   ----------------------------------------------------------------------------------
+ *
+ * @file      DcsBiosAddresses.h
+ * @author    Ulukaii
+ * @date      17.10.2026
+ * @version   t 0.4.0
+ * @copyright Copyright 2016-2026 OpenHornet. See 2A13-BACKLIGHT_CONTROLLER.ino for details.
+ * @brief     F/A-18C export controls used by the backlight controller, as "address, mask, shift" triples.
+ * @details   The addresses are synthetic. Indicators of one panel share a 16-bit word with one bit each, dimmers
+ *            use a full word, as in the real export. To use the real addresses (e.g. to replay a capture from the
+ *            sim), build with DCSBIOS_ADDRESSES=<path to the library's Addresses.h>. The Makefile then
+ *            force-includes that header and defines HOST_REAL_ADDRESSES, which skips the definitions below.
+ *********************************************************************************************************************/
+
+#ifndef __HOST_DCSBIOS_ADDRESSES_H
+#define __HOST_DCSBIOS_ADDRESSES_H
+
+#ifndef HOST_REAL_ADDRESSES
+
+// Caution light panel
+#define FA_18C_hornet_CLIP_APU_ACC_LT            0x7400, 0x0001, 0
+#define FA_18C_hornet_CLIP_BATT_SW_LT            0x7400, 0x0002, 1
+#define FA_18C_hornet_CLIP_CK_SEAT_LT            0x7400, 0x0004, 2
+#define FA_18C_hornet_CLIP_FCES_LT               0x7400, 0x0008, 3
+#define FA_18C_hornet_CLIP_FCS_HOT_LT            0x7400, 0x0010, 4
+#define FA_18C_hornet_CLIP_FUEL_LO_LT            0x7400, 0x0020, 5
+#define FA_18C_hornet_CLIP_GEN_TIE_LT            0x7400, 0x0040, 6
+#define FA_18C_hornet_CLIP_L_GEN_LT              0x7400, 0x0080, 7
+#define FA_18C_hornet_CLIP_R_GEN_LT              0x7400, 0x0100, 8
+#define FA_18C_hornet_CLIP_SPARE_CTN1_LT         0x7400, 0x0200, 9
+#define FA_18C_hornet_CLIP_SPARE_CTN2_LT         0x7400, 0x0400, 10
+#define FA_18C_hornet_CLIP_SPARE_CTN3_LT         0x7400, 0x0800, 11
+
+// Left EWI
+#define FA_18C_hornet_FIRE_LEFT_LT               0x7402, 0x0001, 0
+#define FA_18C_hornet_MASTER_CAUTION_LT          0x7402, 0x0002, 1
+#define FA_18C_hornet_LH_ADV_ASPJ_OH             0x7402, 0x0004, 2
+#define FA_18C_hornet_LH_ADV_GO                  0x7402, 0x0008, 3
+#define FA_18C_hornet_LH_ADV_L_BAR_GREEN         0x7402, 0x0010, 4
+#define FA_18C_hornet_LH_ADV_L_BAR_RED           0x7402, 0x0020, 5
+#define FA_18C_hornet_LH_ADV_L_BLEED             0x7402, 0x0040, 6
+#define FA_18C_hornet_LH_ADV_NO_GO               0x7402, 0x0080, 7
+#define FA_18C_hornet_LH_ADV_REC                 0x7402, 0x0100, 8
+#define FA_18C_hornet_LH_ADV_R_BLEED             0x7402, 0x0200, 9
+#define FA_18C_hornet_LH_ADV_SPD_BRK             0x7402, 0x0400, 10
+#define FA_18C_hornet_LH_ADV_STBY                0x7402, 0x0800, 11
+#define FA_18C_hornet_LH_ADV_XMIT                0x7402, 0x1000, 12
+
+// Right EWI
+#define FA_18C_hornet_FIRE_RIGHT_LT              0x7404, 0x0001, 0
+#define FA_18C_hornet_FIRE_APU_LT                0x7404, 0x0002, 1
+#define FA_18C_hornet_RH_ADV_AAA                 0x7404, 0x0004, 2
+#define FA_18C_hornet_RH_ADV_AI                  0x7404, 0x0008, 3
+#define FA_18C_hornet_RH_ADV_CW                  0x7404, 0x0010, 4
+#define FA_18C_hornet_RH_ADV_DISP                0x7404, 0x0020, 5
+#define FA_18C_hornet_RH_ADV_RCDR_ON             0x7404, 0x0040, 6
+#define FA_18C_hornet_RH_ADV_SAM                 0x7404, 0x0080, 7
+#define FA_18C_hornet_RH_ADV_SPARE_RH1           0x7404, 0x0100, 8
+#define FA_18C_hornet_RH_ADV_SPARE_RH2           0x7404, 0x0200, 9
+#define FA_18C_hornet_RH_ADV_SPARE_RH3           0x7404, 0x0400, 10
+#define FA_18C_hornet_RH_ADV_SPARE_RH4           0x7404, 0x0800, 11
+#define FA_18C_hornet_RH_ADV_SPARE_RH5           0x7404, 0x1000, 12
+
+// Master arm, spin, ECM, weight on wheels
+#define FA_18C_hornet_MASTER_MODE_AA_LT          0x7406, 0x0001, 0
+#define FA_18C_hornet_MASTER_MODE_AG_LT          0x7406, 0x0002, 1
+#define FA_18C_hornet_MC_DISCH                   0x7406, 0x0004, 2
+#define FA_18C_hornet_MC_READY                   0x7406, 0x0008, 3
+#define FA_18C_hornet_SPIN_LT                    0x7406, 0x0010, 4
+#define FA_18C_hornet_CMSD_JET_SEL_L             0x7406, 0x0020, 5
+#define FA_18C_hornet_EXT_WOW_LEFT               0x7406, 0x0040, 6
+
+// Jettison station select and landing gear/flaps
+#define FA_18C_hornet_SJ_CTR_LT                  0x7408, 0x0001, 0
+#define FA_18C_hornet_SJ_LI_LT                   0x7408, 0x0002, 1
+#define FA_18C_hornet_SJ_LO_LT                   0x7408, 0x0004, 2
+#define FA_18C_hornet_SJ_RI_LT                   0x7408, 0x0008, 3
+#define FA_18C_hornet_SJ_RO_LT                   0x7408, 0x0010, 4
+#define FA_18C_hornet_FLP_LG_FLAPS_LT            0x7408, 0x0020, 5
+#define FA_18C_hornet_FLP_LG_FULL_FLAPS_LT       0x7408, 0x0040, 6
+#define FA_18C_hornet_FLP_LG_HALF_FLAPS_LT       0x7408, 0x0080, 7
+#define FA_18C_hornet_FLP_LG_LEFT_GEAR_LT        0x7408, 0x0100, 8
+#define FA_18C_hornet_FLP_LG_NOSE_GEAR_LT        0x7408, 0x0200, 9
+#define FA_18C_hornet_FLP_LG_RIGHT_GEAR_LT       0x7408, 0x0400, 10
+
+// RWR control
+#define FA_18C_hornet_RWR_ENABLE_LT              0x740a, 0x0001, 0
+#define FA_18C_hornet_RWR_FAIL_LT                0x740a, 0x0002, 1
+#define FA_18C_hornet_RWR_LIMIT_LT               0x740a, 0x0004, 2
+#define FA_18C_hornet_RWR_LOWER_LT               0x740a, 0x0008, 3
+#define FA_18C_hornet_RWR_SPECIAL_EN_LT          0x740a, 0x0010, 4
+
+// Cockpit light mode switch (2-bit field) and dimmers (full words)
+#define FA_18C_hornet_COCKKPIT_LIGHT_MODE_SW     0x740c, 0x0003, 0
+#define FA_18C_hornet_INSTR_INT_LT               0x7410, 0xffff, 0
+#define FA_18C_hornet_CONSOLES_DIMMER            0x7412, 0xffff, 0
+#define FA_18C_hornet_FLOOD_DIMMER               0x7414, 0xffff, 0
+
+#endif // HOST_REAL_ADDRESSES
+
+#endif
@@ -0,0 +1,193 @@
+/**********************************************************************************************************************
+ *        ____                   _    _                       _
+ *       / __ \                 | |  | |                     | |
+ *      | |  | |_ __   ___ _ __ | |__| | ___  _ __ _ __   ___| |_
+ *      | |  | | '_ \ / _ \ '_ \|  __  |/ _ \| '__| '_ \ / _ \ __|
+ *      | |__| | |_) |  __/ | | | |  | | (_) | |  | | | |  __/ |_
+ *       \____/| .__/ \___|_| |_|_|  |_|\___/|_|  |_| |_|\___|\__|
+ *             | |
+ *             |_|
+ *   ----------------------------------------------------------------------------------
+ *
+ * @file      FastLED.h
+ * @author    Ulukaii
+ * @date      17.10.2026
+ * @version   t 0.4.0
+ * @copyright Copyright 2016-2026 OpenHornet. See 2A13-BACKLIGHT_CONTROLLER.ino for details.
+ * @brief     FastLED stub for the host build of the backlight controller.
+ * @details   Implements the subset of the FastLED API used by the sketch. Instead of driving a pin, each controller
+ *            records its output: the number of showLeds() calls, the number of LEDs pushed, and a copy of the last
+ *            frame it sent. showLeds() advances the simulated clock by the WS2812B wire time (30 us per LED), so
+ *            the sketch's frame pacing sees realistic output durations.
+ *            The color math (nscale8_video) matches FastLED; hsv2rgb_rainbow() is a plain HSV conversion, which is
+ *            sufficient for rainbow test mode.
+ *********************************************************************************************************************/
+
+#ifndef __HOST_FASTLED_H
+#define __HOST_FASTLED_H
+
+#include <Arduino.h>
+#include <vector>
+
+/**
+ * @brief Same layout and color math as FastLED's CRGB
+ */
+struct CRGB {
+    union {
+        struct {
+            uint8_t r;
+            uint8_t g;
+            uint8_t b;
+        };
+        uint8_t raw[3];
+    };
+
+    CRGB() : r(0), g(0), b(0) {}
+    constexpr CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+
+    uint8_t& operator[](uint8_t i) { return raw[i]; }
+    const uint8_t& operator[](uint8_t i) const { return raw[i]; }
+
+    CRGB& nscale8_video(uint8_t scale) {
+        uint8_t nonzeroscale = (scale != 0) ? 1 : 0;
+        r = (r == 0) ? 0 : ((r * scale) >> 8) + nonzeroscale;
+        g = (g == 0) ? 0 : ((g * scale) >> 8) + nonzeroscale;
+        b = (b == 0) ? 0 : ((b * scale) >> 8) + nonzeroscale;
+        return *this;
+    }
+
+    CRGB& nscale8(uint8_t scale) {
+        r = (r * (scale + 1)) >> 8;
+        g = (g * (scale + 1)) >> 8;
+        b = (b * (scale + 1)) >> 8;
+        return *this;
+    }
+};
+
+inline bool operator==(const CRGB& a, const CRGB& b) { return a.r == b.r && a.g == b.g && a.b == b.b; }
+inline bool operator!=(const CRGB& a, const CRGB& b) { return !(a == b); }
+
+struct CHSV {
+    uint8_t h;
+    uint8_t s;
+    uint8_t v;
+    CHSV(uint8_t ih, uint8_t is, uint8_t iv) : h(ih), s(is), v(iv) {}
+};
+
+inline void hsv2rgb_rainbow(const CHSV& hsv, CRGB& rgb) {
+    uint8_t sector = hsv.h / 43;
+    uint8_t rise = (hsv.h - sector * 43) * 6;
+    uint8_t low = (hsv.v * (255 - hsv.s)) >> 8;
+    uint8_t fall = (hsv.v * (255 - ((hsv.s * rise) >> 8))) >> 8;
+    uint8_t up = (hsv.v * (255 - ((hsv.s * (255 - rise)) >> 8))) >> 8;
+    switch (sector) {
+        case 0:  rgb = CRGB(hsv.v, up, low); break;
+        case 1:  rgb = CRGB(fall, hsv.v, low); break;
+        case 2:  rgb = CRGB(low, hsv.v, up); break;
+        case 3:  rgb = CRGB(low, fall, hsv.v); break;
+        case 4:  rgb = CRGB(up, low, hsv.v); break;
+        default: rgb = CRGB(hsv.v, low, fall); break;
+    }
+}
+
+inline uint8_t scale8(uint8_t i, uint8_t scale) { return (i * (scale + 1)) >> 8; }
+inline uint8_t scale8_video(uint8_t i, uint8_t scale) { return i == 0 ? 0 : ((i * scale) >> 8) + (scale ? 1 : 0); }
+
+inline void fill_solid(CRGB* leds, int count, const CRGB& color) {
+    for (int i = 0; i < count; i++) leds[i] = color;
+}
+
+inline void nscale8_video(CRGB* leds, uint16_t count, uint8_t scale) {
+    for (uint16_t i = 0; i < count; i++) leds[i].nscale8_video(scale);
+}
+
+inline uint8_t calculate_max_brightness_for_power_mW(const CRGB*, uint16_t, uint8_t target, uint32_t) { return target; }
+
+enum EOrder { RGB = 0012, RBG = 0021, GRB = 0102, GBR = 0120, BRG = 0201, BGR = 0210 };
+enum ESPIChipsets { WS2812B };
+
+/**
+ * @brief Records what the sketch outputs on one pin
+ */
+class CLEDController {
+public:
+    static const uint8_t WIRE_US_PER_LED = 30;                       // WS2812B: 24 bits at 1.25 us
+
+    uint8_t pin = 0;                                                  // Data pin given to addLeds()
+    EOrder order = RGB;                                               // Color order given to addLeds()
+    CRGB* data = nullptr;                                             // Buffer the sketch fills before showLeds()
+    int count = 0;                                                    // Number of LEDs on the pin
+    unsigned long shows = 0;                                          // Number of showLeds() calls
+    unsigned long ledsOut = 0;                                        // Number of LEDs pushed in total
+    unsigned long aborts = 0;                                         // Number of outputs aborted by abortHook
+    uint8_t lastBrightness = 0;                                       // Brightness of the last showLeds()
+    std::vector<CRGB> shown;                                          // Copy of the last frame sent, before brightness
+
+    static void (*showHook)(const CLEDController& controller);        // Called after every showLeds(), if set
+    static bool (*abortHook)(const CLEDController& controller);       // Returns true to abort an output, if set
+
+    /**
+     * @brief Outputs the LEDs, as FastLED does with FASTLED_ALLOW_INTERRUPTS
+     * @details Interrupts are off while one LED is sent and served between LEDs, so the RX interrupt is held off
+     *          for one LED at a time (one such window is reported per output, they all have the same length),
+     *          unless it is masked for the whole output. While the RX interrupt can run,
+     *          abortHook may abort the output as a too long interrupt would: it then returns after a tenth of the
+     *          wire time, and the strip keeps what it showed before (shown is unchanged).
+     */
+    void showLeds(uint8_t brightness = 255) {
+        bool windows = hostRxHolds == 0;                              // RX interrupt served between LEDs
+        if (windows && abortHook && abortHook(*this)) {
+            aborts++;
+            hostMicros += WIRE_US_PER_LED * count / 10;
+            return;
+        }
+        shown.assign(data, data + count);
+        lastBrightness = brightness;
+        shows++;
+        ledsOut += count;
+        hostMicros += WIRE_US_PER_LED * count;
+        if (windows && count > 0 && hostRxHeldHook) hostRxHeldHook(hostMicros - WIRE_US_PER_LED, hostMicros);
+        if (showHook) showHook(*this);
+    }
+
+    int size() const { return count; }
+    CRGB* leds() { return data; }
+};
+
+/**
+ * @brief Holds up to 16 controllers, like FastLED's global controller list
+ */
+class CFastLED {
+public:
+    static const int MAX_CONTROLLERS = 16;
+
+    template<ESPIChipsets CHIPSET, uint8_t DATA_PIN, EOrder ORDER>
+    CLEDController& addLeds(CRGB* data, int count) {
+        CLEDController& controller = controllers[controllerCount++];
+        controller.pin = DATA_PIN;
+        controller.order = ORDER;
+        controller.data = data;
+        controller.count = count;
+        return controller;
+    }
+
+    void show() {
+        for (int i = 0; i < controllerCount; i++) controllers[i].showLeds(brightness);
+    }
+
+    uint8_t getBrightness() const { return brightness; }
+    void setBrightness(uint8_t value) { brightness = value; }
+    void setMaxRefreshRate(uint16_t, bool = false) {}
+    void setMaxPowerInVoltsAndMilliamps(uint8_t, uint32_t) {}
+    int count() const { return controllerCount; }
+    CLEDController& operator[](int i) { return controllers[i]; }
+
+private:
+    CLEDController controllers[MAX_CONTROLLERS];
+    int controllerCount = 0;
+    uint8_t brightness = 255;
+};
+
+extern CFastLED FastLED;
+
+#endif
@@ -0,0 +1,46 @@
+/**********************************************************************************************************************
+ *        ____                   _    _                       _
+ *       / __ \                 | |  | |                     | |
+ *      | |  | |_ __   ___ _ __ | |__| | ___  _ __ _ __   ___| |_
+ *      | |  | | '_ \ / _ \ '_ \|  __  |/ _ \| '__| '_ \ / _ \ __|
+ *      | |__| | |_) |  __/ | | | |  | | (_) | |  | | | |  __/ |_
+ *       \____/| .__/ \___|_| |_|_|  |_|\___/|_|  |_| |_|\___|\__|
+ *             | |
+ *             |_|
+ *   ----------------------------------------------------------------------------------
+ *
+ * @file      HostStubs.cpp
+ * @author    Ulukaii
+ * @date      17.10.2026
+ * @version   t 0.4.0
+ * @copyright Copyright 2016-2026 OpenHornet. See 2A13-BACKLIGHT_CONTROLLER.ino for details.
+ * @brief     Storage for the globals of the host stubs (clock, pins, FastLED, DCS-BIOS listener list).
+ *********************************************************************************************************************/
+
+#include <Arduino.h>
+#include "FastLED.h"
+#include "DcsBios.h"
+
+uint32_t hostMicros = 0;
+uint8_t hostRxHolds = 0;
+uint32_t hostRxHeldSinceUs = 0;
+void (*hostRxHeldHook)(uint32_t fromUs, uint32_t toUs) = nullptr;
+HostUartControl hostUCSR0B;
+uint8_t hostPinLevel[70] = {                                          // Inputs idle high (INPUT_PULLUP)
+    HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH,
+    HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH,
+    HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH,
+    HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH,
+    HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH
+};
+HostSerial Serial;
+
+CFastLED FastLED;
+void (*CLEDController::showHook)(const CLEDController& controller) = nullptr;
+bool (*CLEDController::abortHook)(const CLEDController& controller) = nullptr;
+
+DcsBios::ExportStreamListener* DcsBios::ExportStreamListener::first = nullptr;
+void (*DcsBios::hostWriteHook)(unsigned int address, unsigned int value) = nullptr;
+void (*DcsBios::hostLoopHook)() = nullptr;
+unsigned long hostMessagesSent = 0;
+void (*hostMessageHook)(const char* msg, const char* arg) = nullptr;
@@ -25,20 +25,15 @@
 #include "../helpers/Panel.h"
 
 /********************************************************************************************************************
- * @brief   This table defines the panel's LEDs.
+ * @brief   This table defines the panel's LEDs as runs of consecutive LEDs sharing a role.
  * @details "Role" in this context refers to the LED role enum in the Panel.h file (enum used for memory efficiency).
  * @remark  This table is stored in PROGMEM for memory efficiency.
  ********************************************************************************************************************/
 const int SIM_PWR_PANEL_LED_COUNT = 35;  // Total number of LEDs in the panel
-const Led simPwrPanelLedTable[SIM_PWR_PANEL_LED_COUNT] PROGMEM = {
-    {0, LED_CONSOLE_BL}, {1, LED_CONSOLE_BL}, {2, LED_CONSOLE_BL}, {3, LED_CONSOLE_BL}, {4, LED_CONSOLE_BL}, 
-    {5, LED_CONSOLE_BL}, {6, LED_CONSOLE_BL}, {7, LED_CONSOLE_BL}, {8, LED_CONSOLE_BL}, {9, LED_CONSOLE_BL},
-    {10, LED_CONSOLE_BL}, {11, LED_CONSOLE_BL}, {12, LED_CONSOLE_BL}, {13, LED_CONSOLE_BL}, {14, LED_CONSOLE_BL}, 
-    {15, LED_CONSOLE_BL}, {16, LED_CONSOLE_BL}, {17, LED_CONSOLE_BL}, {18, LED_CONSOLE_BL}, {19, LED_CONSOLE_BL},
-    {20, LED_CONSOLE_BL}, {21, LED_CONSOLE_BL}, {22, LED_CONSOLE_BL}, {23, LED_CONSOLE_BL}, {24, LED_CONSOLE_BL}, 
-    {25, LED_CONSOLE_BL}, {26, LED_CONSOLE_BL}, {27, LED_CONSOLE_BL}, {28, LED_CONSOLE_BL}, {29, LED_CONSOLE_BL},
-    {30, LED_CONSOLE_BL}, {31, LED_CONSOLE_BL}, {32, LED_CONSOLE_BL}, {33, LED_CONSOLE_BL}, {34, LED_CONSOLE_BL}
+constexpr LedRun simPwrPanelLedRuns[] PROGMEM = {
+    {0, 35, LED_CONSOLE_BL}
 };
+static_assert(ledRunsValid(simPwrPanelLedRuns, SIM_PWR_PANEL_LED_COUNT), "simPwrPanelLedRuns overlap or exceed SIM_PWR_PANEL_LED_COUNT");
 
 /********************************************************************************************************************
  * @brief   Sim Pwr Panel class
@@ -58,9 +53,10 @@ public:
      * @return Pointer to the singleton instance
      * @see This method is called by the main .ino file's addPanel() method to create the panel instance
      */
-    static SimPwrPanel* getInstance(int startIndex = 0, CRGB* ledStrip = nullptr) {
+    static SimPwrPanel* getInstance(int startIndex = 0, uint8_t* ledStrip = nullptr) {
         if (!instance) {
-            instance = new SimPwrPanel(startIndex, ledStrip);
+            static SimPwrPanel panel(startIndex, ledStrip);
+            instance = &panel;                                        // Static storage, no heap allocation
         }
         return instance;
     }
@@ -72,11 +68,11 @@ private:
      * @param ledStrip Pointer to the LED strip array
      * @see This method is called by the public getInstance() if and only if no instance exists yet
      */
-    SimPwrPanel(int startIndex, CRGB* ledStrip) {
+    SimPwrPanel(int startIndex, uint8_t* ledStrip) {
         panelStartIndex = startIndex;
         this->ledStrip = ledStrip;
         ledCount = SIM_PWR_PANEL_LED_COUNT;
-        ledTable = simPwrPanelLedTable;
+        setLedRuns(simPwrPanelLedRuns);
     }
 
     // Static callback functions for DCS-BIOS
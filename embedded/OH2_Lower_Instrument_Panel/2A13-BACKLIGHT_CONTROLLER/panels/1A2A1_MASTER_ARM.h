@@ -31,29 +31,24 @@
 
 
 /********************************************************************************************************************
- * @brief   This table defines the panel's LEDs.
+ * @brief   This table defines the panel's LEDs as runs of consecutive LEDs sharing a role.
  * @details "Role" in this context refers to the LED role enum in the LedRole.h file (enum used for memory efficiency).
  * @remark  This table is stored in PROGMEM for memory efficiency.
- * @see     LedRole.h for the list of LED roles and LedStruct.h for the Led structure.
+ * @see     LedRole.h for the list of LED roles and LedStruct.h for the LedRun structure.
  ********************************************************************************************************************/
 const int MASTER_ARM_LED_COUNT = 29;  // Total number of LEDs in the panel
-const Led masterArmLedTable[MASTER_ARM_LED_COUNT] PROGMEM = {
-    {0, LED_READY}, {1, LED_READY}, {2, LED_DISCH}, {3, LED_DISCH}, 
-    {4, LED_INSTR_BL}, {5, LED_INSTR_BL}, {6, LED_INSTR_BL}, 
-    {7, LED_INSTR_BL}, {8, LED_INSTR_BL}, {9, LED_INSTR_BL},
-    {10, LED_INSTR_BL}, {11, LED_INSTR_BL}, {12, LED_INSTR_BL}, 
-    {13, LED_INSTR_BL}, {14, LED_INSTR_BL}, {15, LED_INSTR_BL}, 
-    {16, LED_INSTR_BL}, {17, LED_INSTR_BL}, {18, LED_INSTR_BL}, 
-    {19, LED_INSTR_BL}, {20, LED_INSTR_BL}, {21, LED_INSTR_BL}, 
-    {22, LED_INSTR_BL}, {23, LED_INSTR_BL}, {24, LED_INSTR_BL}, 
-    {25, LED_AG}, {26, LED_AG}, {27, LED_AA}, {28, LED_AA}
+constexpr LedRun masterArmLedRuns[] PROGMEM = {
+    {0, 2, LED_READY}, {2, 2, LED_DISCH},
+    {4, 21, LED_INSTR_BL},
+    {25, 2, LED_AG}, {27, 2, LED_AA}
 };
+static_assert(ledRunsValid(masterArmLedRuns, MASTER_ARM_LED_COUNT), "masterArmLedRuns overlap or exceed MASTER_ARM_LED_COUNT");
 
 /********************************************************************************************************************
  * @brief   This table defines the optional legend text for specific backlight LEDs.
  * @details Only LEDs that need text are included in this table.
  * @remark  This table is stored in PROGMEM for memory efficiency.
- * @see     LedStruct.h for the Led structure.
+ * @see     LedStruct.h for the LedText structure.
  ********************************************************************************************************************/
 const int MASTER_ARM_TEXT_COUNT = 3;  // Number of LEDs that need text
 const LedText masterArmTextTable[MASTER_ARM_TEXT_COUNT] PROGMEM = {
@@ -62,6 +57,19 @@ const LedText masterArmTextTable[MASTER_ARM_TEXT_COUNT] PROGMEM = {
     {21, "MASTER"}
 };
 
+/********************************************************************************************************************
+ * @brief   This table binds the panel's indicator LEDs to their DCS-BIOS outputs.
+ * @details Each entry sets the LEDs of one role to the first color while the indicator is on, else to the second.
+ * @remark  This table is stored in PROGMEM for memory efficiency.
+ * @see     Panel.h for the IndicatorBinding structure.
+ ********************************************************************************************************************/
+constexpr IndicatorBinding masterArmIndicators[] PROGMEM = {
+    {FA_18C_hornet_MC_READY,          LED_READY, NVIS_YELLOW,  NVIS_BLACK},
+    {FA_18C_hornet_MC_DISCH,          LED_DISCH, NVIS_GREEN_A, NVIS_BLACK},
+    {FA_18C_hornet_MASTER_MODE_AG_LT, LED_AG,    NVIS_GREEN_A, NVIS_BLACK},
+    {FA_18C_hornet_MASTER_MODE_AA_LT, LED_AA,    NVIS_GREEN_A, NVIS_BLACK}
+};
+
 /********************************************************************************************************************
  * @brief   Master Arm Panel class
  * @details Backlighting and indicator controller for the Master Arm panel.
@@ -80,9 +88,10 @@ public:
      * @return Pointer to the singleton instance
      * @see This method is called by Channel::addPanel() when adding the Master Arm panel to a channel
      */
-    static MasterArmPanel* getInstance(int startIndex = 0, CRGB* ledStrip = nullptr) {
+    static MasterArmPanel* getInstance(int startIndex = 0, uint8_t* ledStrip = nullptr) {
         if (!instance) {
-            instance = new MasterArmPanel(startIndex, ledStrip);
+            static MasterArmPanel panel(startIndex, ledStrip);
+            instance = &panel;                                        // Static storage, no heap allocation
         }
         return instance;
     }
@@ -94,52 +103,15 @@ private:
      * @param ledStrip Pointer to the LED strip array
      * @see This method is called by the public getInstance() if and only if not instance exists yet.
      */
-    MasterArmPanel(int startIndex, CRGB* ledStrip) {
+    MasterArmPanel(int startIndex, uint8_t* ledStrip) {
         panelStartIndex = startIndex;
         this->ledStrip = ledStrip;
         ledCount = MASTER_ARM_LED_COUNT;
-        ledTable = masterArmLedTable;
-    }
-
-    /**
-     * @brief Callback for Master Caution Ready light changes from DCS-BIOS
-     * @param newValue The new state of the Ready light (0 or 1)
-     * @see This method is called by DCS-BIOS when the Ready light state changes
-     */
-    static void onMcReadyChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_READY, newValue ? NVIS_YELLOW : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer mcReadyBuffer{FA_18C_hornet_MC_READY, onMcReadyChange};
-
-    /**
-     * @brief Callback for Master Caution Discharge light changes from DCS-BIOS
-     * @param newValue The new state of the Discharge light (0 or 1)
-     * @see This method is called by DCS-BIOS when the Discharge light state changes
-     */
-    static void onMcDischChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_DISCH, newValue ? NVIS_GREEN_A : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer mcDischBuffer{FA_18C_hornet_MC_DISCH, onMcDischChange};
-
-    /**
-     * @brief Callback for Master Mode A/G light changes from DCS-BIOS
-     * @param newValue The new state of the A/G light (0 or 1)
-     * @see This method is called by DCS-BIOS when the A/G light state changes
-     */
-    static void onMasterModeAgLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_AG, newValue ? NVIS_GREEN_A : NVIS_BLACK);
+        setLedRuns(masterArmLedRuns);
     }
-    DcsBios::IntegerBuffer masterModeAgLtBuffer{FA_18C_hornet_MASTER_MODE_AG_LT, onMasterModeAgLtChange};
 
-    /**
-     * @brief Callback for Master Mode A/A light changes from DCS-BIOS
-     * @param newValue The new state of the A/A light (0 or 1)
-     * @see This method is called by DCS-BIOS when the A/A light state changes
-     */
-    static void onMasterModeAaLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_AA, newValue ? NVIS_GREEN_A : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer masterModeAaLtBuffer{FA_18C_hornet_MASTER_MODE_AA_LT, onMasterModeAaLtChange};
+    // DCS-BIOS indicator outputs, served by one listener (see masterArmIndicators above)
+    IndicatorBindings indicators{this, masterArmIndicators};
 
     // Instance data
     static MasterArmPanel* instance;
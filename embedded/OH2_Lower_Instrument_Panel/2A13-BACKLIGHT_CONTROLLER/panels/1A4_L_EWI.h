@@ -29,19 +29,42 @@
 
 
 /********************************************************************************************************************
- * @brief   This table defines the panel's LEDs.
+ * @brief   This table defines the panel's LEDs as runs of consecutive LEDs sharing a role.
  * @details "Role" in this context refers to the LED role enum in the LedRole.h file (enum used for memory efficiency).
  * @remark  This table is stored in PROGMEM for memory efficiency.
- * @see     LedRole.h for the list of LED roles and LedStruct.h for the Led structure.
+ * @see     LedRole.h for the list of LED roles and LedStruct.h for the LedRun structure.
  ********************************************************************************************************************/
 const int L_EWI_LED_COUNT = 30;  // Total number of LEDs in the panel
-const Led lEwiLedTable[L_EWI_LED_COUNT] PROGMEM = {
-    {0, LED_FIRE}, {1, LED_FIRE}, {2, LED_FIRE}, {3, LED_FIRE}, {4, LED_CAUTION}, 
-    {5, LED_CAUTION}, {6, LED_CAUTION}, {7, LED_CAUTION}, {8, LED_GO}, {9, LED_GO},
-    {10, LED_NO_GO}, {11, LED_NO_GO}, {12, LED_R_BLEED}, {13, LED_R_BLEED}, {14, LED_L_BLEED}, 
-    {15, LED_L_BLEED}, {16, LED_SPD_BRK}, {17, LED_SPD_BRK}, {18, LED_STBY}, {19, LED_STBY},
-    {20, LED_REC}, {21, LED_REC}, {22, LED_L_BAR1}, {23, LED_L_BAR1}, {24, LED_L_BAR2}, 
-    {25, LED_L_BAR2}, {26, LED_XMIT}, {27, LED_XMIT}, {28, LED_ASPJ_ON}, {29, LED_ASPJ_ON}
+constexpr LedRun lEwiLedRuns[] PROGMEM = {
+    {0, 4, LED_FIRE},
+    {4, 4, LED_CAUTION}, {8, 2, LED_GO},
+    {10, 2, LED_NO_GO}, {12, 2, LED_R_BLEED},
+    {14, 2, LED_L_BLEED}, {16, 2, LED_SPD_BRK}, {18, 2, LED_STBY},
+    {20, 2, LED_REC}, {22, 2, LED_L_BAR1},
+    {24, 2, LED_L_BAR2}, {26, 2, LED_XMIT}, {28, 2, LED_ASPJ_ON}
+};
+static_assert(ledRunsValid(lEwiLedRuns, L_EWI_LED_COUNT), "lEwiLedRuns overlap or exceed L_EWI_LED_COUNT");
+
+/********************************************************************************************************************
+ * @brief   This table binds the panel's indicator LEDs to their DCS-BIOS outputs.
+ * @details Each entry sets the LEDs of one role to the first color while the indicator is on, else to the second.
+ * @remark  This table is stored in PROGMEM for memory efficiency.
+ * @see     Panel.h for the IndicatorBinding structure.
+ ********************************************************************************************************************/
+constexpr IndicatorBinding lEwiIndicators[] PROGMEM = {
+    {FA_18C_hornet_FIRE_LEFT_LT,       LED_FIRE,    NVIS_RED,     NVIS_BLACK},
+    {FA_18C_hornet_MASTER_CAUTION_LT,  LED_CAUTION, NVIS_YELLOW,  NVIS_BLACK},
+    {FA_18C_hornet_LH_ADV_ASPJ_OH,     LED_ASPJ_ON, NVIS_YELLOW,  NVIS_BLACK},
+    {FA_18C_hornet_LH_ADV_GO,          LED_GO,      NVIS_GREEN_A, NVIS_BLACK},
+    {FA_18C_hornet_LH_ADV_L_BAR_GREEN, LED_L_BAR2,  NVIS_GREEN_A, NVIS_BLACK},
+    {FA_18C_hornet_LH_ADV_L_BAR_RED,   LED_L_BAR1,  NVIS_RED,     NVIS_BLACK},
+    {FA_18C_hornet_LH_ADV_L_BLEED,     LED_L_BLEED, NVIS_RED,     NVIS_BLACK},
+    {FA_18C_hornet_LH_ADV_NO_GO,       LED_NO_GO,   NVIS_YELLOW,  NVIS_BLACK},
+    {FA_18C_hornet_LH_ADV_R_BLEED,     LED_R_BLEED, NVIS_RED,     NVIS_BLACK},
+    {FA_18C_hornet_LH_ADV_REC,         LED_REC,     NVIS_GREEN_A, NVIS_BLACK},
+    {FA_18C_hornet_LH_ADV_SPD_BRK,     LED_SPD_BRK, NVIS_GREEN_A, NVIS_BLACK},
+    {FA_18C_hornet_LH_ADV_STBY,        LED_STBY,    NVIS_GREEN_A, NVIS_BLACK},
+    {FA_18C_hornet_LH_ADV_XMIT,        LED_XMIT,    NVIS_GREEN_A, NVIS_BLACK}
 };
 
 /********************************************************************************************************************
@@ -64,9 +87,10 @@ public:
      * @return Pointer to the singleton instance
      * @see This method is called by the main .ino file's addPanel() method to create the panel instance
      */
-    static EwiPanel* getInstance(int startIndex = 0, CRGB* ledStrip = nullptr) {
+    static EwiPanel* getInstance(int startIndex = 0, uint8_t* ledStrip = nullptr) {
         if (!instance) {
-            instance = new EwiPanel(startIndex, ledStrip);
+            static EwiPanel panel(startIndex, ledStrip);
+            instance = &panel;                                        // Static storage, no heap allocation
         }
         return instance;
     }
@@ -78,82 +102,15 @@ private:
      * @param ledStrip Pointer to the LED strip array
      * @see This method is called by the public getInstance() if and only if no instance exists yet
      */
-    EwiPanel(int startIndex, CRGB* ledStrip) {
+    EwiPanel(int startIndex, uint8_t* ledStrip) {
         panelStartIndex = startIndex;
         this->ledStrip = ledStrip;
         ledCount = L_EWI_LED_COUNT;
-        ledTable = lEwiLedTable;
-    }
-
-    /**
-     * @brief Callback for FIRE LEFT indicator
-     * @param newValue The new state of the indicator (0 or 1)
-     * @see This method is called by DCS-BIOS when the FIRE LEFT indicator state changes
-     */
-    static void onFireLeftLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_FIRE, newValue ? NVIS_RED : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer fireLeftLtBuffer{FA_18C_hornet_FIRE_LEFT_LT, onFireLeftLtChange};
-
-    static void onMasterCautionLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_CAUTION, newValue ? NVIS_YELLOW : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer masterCautionLtBuffer{FA_18C_hornet_MASTER_CAUTION_LT, onMasterCautionLtChange};
-
-    static void onLhAdvAspjOhChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_ASPJ_ON, newValue ? NVIS_YELLOW : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer lhAdvAspjOhBuffer{FA_18C_hornet_LH_ADV_ASPJ_OH, onLhAdvAspjOhChange};
-
-    static void onLhAdvGoChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_GO, newValue ? NVIS_GREEN_A : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer lhAdvGoBuffer{FA_18C_hornet_LH_ADV_GO, onLhAdvGoChange};
-
-    static void onLhAdvLBarGreenChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_L_BAR2, newValue ? NVIS_GREEN_A : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer lhAdvLBarGreenBuffer{FA_18C_hornet_LH_ADV_L_BAR_GREEN, onLhAdvLBarGreenChange};
-
-    static void onLhAdvLBarRedChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_L_BAR1, newValue ? NVIS_RED : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer lhAdvLBarRedBuffer{FA_18C_hornet_LH_ADV_L_BAR_RED, onLhAdvLBarRedChange};
-
-    static void onLhAdvLBleedChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_L_BLEED, newValue ? NVIS_RED : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer lhAdvLBleedBuffer{FA_18C_hornet_LH_ADV_L_BLEED, onLhAdvLBleedChange};
-
-    static void onLhAdvNoGoChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_NO_GO, newValue ? NVIS_YELLOW : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer lhAdvNoGoBuffer{FA_18C_hornet_LH_ADV_NO_GO, onLhAdvNoGoChange};
-
-    static void onLhAdvRBleedChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_R_BLEED, newValue ? NVIS_RED : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer lhAdvRBleedBuffer{FA_18C_hornet_LH_ADV_R_BLEED, onLhAdvRBleedChange};
-
-    static void onLhAdvRecChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_REC, newValue ? NVIS_GREEN_A : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer lhAdvRecBuffer{FA_18C_hornet_LH_ADV_REC, onLhAdvRecChange};
-
-    static void onLhAdvSpdBrkChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_SPD_BRK, newValue ? NVIS_GREEN_A : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer lhAdvSpdBrkBuffer{FA_18C_hornet_LH_ADV_SPD_BRK, onLhAdvSpdBrkChange};
-
-    static void onLhAdvStbyChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_STBY, newValue ? NVIS_GREEN_A : NVIS_BLACK);
+        setLedRuns(lEwiLedRuns);
     }
-    DcsBios::IntegerBuffer lhAdvStbyBuffer{FA_18C_hornet_LH_ADV_STBY, onLhAdvStbyChange};
 
-    static void onLhAdvXmitChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_XMIT, newValue ? NVIS_GREEN_A : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer lhAdvXmitBuffer{FA_18C_hornet_LH_ADV_XMIT, onLhAdvXmitChange};
+    // DCS-BIOS indicator outputs, served by one listener (see lEwiIndicators above)
+    IndicatorBindings indicators{this, lEwiIndicators};
 
     // Instance data
     static EwiPanel* instance;
@@ -29,19 +29,42 @@
 
 
 /********************************************************************************************************************
- * @brief   This table defines the panel's LEDs.
+ * @brief   This table defines the panel's LEDs as runs of consecutive LEDs sharing a role.
  * @details "Role" in this context refers to the LED role enum in the LedRole.h file (enum used for memory efficiency).
  * @remark  This table is stored in PROGMEM for memory efficiency.
- * @see     LedRole.h for the list of LED roles and LedStruct.h for the Led structure.
+ * @see     LedRole.h for the list of LED roles and LedStruct.h for the LedRun structure.
  ********************************************************************************************************************/
 const int R_EWI_LED_COUNT = 30;  // Total number of LEDs in the panel
-const Led rEwiLedTable[R_EWI_LED_COUNT] PROGMEM = {
-    {0, LED_R_FIRE}, {1, LED_R_FIRE}, {2, LED_R_FIRE}, {3, LED_R_FIRE}, {4, LED_APU_FIRE},
-    {5, LED_APU_FIRE}, {6, LED_APU_FIRE}, {7, LED_APU_FIRE}, {8, LED_DISP}, {9, LED_DISP},
-    {10, LED_RCDRON}, {11, LED_RCDRON}, {12, LED_SPARE1}, {13, LED_SPARE1}, {14, LED_SPARE2},
-    {15, LED_SPARE2}, {16, LED_SPARE3}, {17, LED_SPARE3}, {18, LED_SPARE4}, {19, LED_SPARE4},
-    {20, LED_SPARE5}, {21, LED_SPARE5}, {22, LED_SAM}, {23, LED_SAM}, {24, LED_AAA},
-    {25, LED_AAA}, {26, LED_AI}, {27, LED_AI}, {28, LED_CW}, {29, LED_CW}
+constexpr LedRun rEwiLedRuns[] PROGMEM = {
+    {0, 4, LED_R_FIRE},
+    {4, 4, LED_APU_FIRE}, {8, 2, LED_DISP},
+    {10, 2, LED_RCDRON}, {12, 2, LED_SPARE1},
+    {14, 2, LED_SPARE2}, {16, 2, LED_SPARE3}, {18, 2, LED_SPARE4},
+    {20, 2, LED_SPARE5}, {22, 2, LED_SAM},
+    {24, 2, LED_AAA}, {26, 2, LED_AI}, {28, 2, LED_CW}
+};
+static_assert(ledRunsValid(rEwiLedRuns, R_EWI_LED_COUNT), "rEwiLedRuns overlap or exceed R_EWI_LED_COUNT");
+
+/********************************************************************************************************************
+ * @brief   This table binds the panel's indicator LEDs to their DCS-BIOS outputs.
+ * @details Each entry sets the LEDs of one role to the first color while the indicator is on, else to the second.
+ * @remark  This table is stored in PROGMEM for memory efficiency.
+ * @see     Panel.h for the IndicatorBinding structure.
+ ********************************************************************************************************************/
+constexpr IndicatorBinding rEwiIndicators[] PROGMEM = {
+    {FA_18C_hornet_FIRE_RIGHT_LT,    LED_R_FIRE,   NVIS_RED,     NVIS_BLACK},
+    {FA_18C_hornet_FIRE_APU_LT,      LED_APU_FIRE, NVIS_RED,     NVIS_BLACK},
+    {FA_18C_hornet_RH_ADV_AAA,       LED_AAA,      NVIS_GREEN_A, NVIS_BLACK},
+    {FA_18C_hornet_RH_ADV_AI,        LED_AI,       NVIS_GREEN_A, NVIS_BLACK},
+    {FA_18C_hornet_RH_ADV_CW,        LED_CW,       NVIS_GREEN_A, NVIS_BLACK},
+    {FA_18C_hornet_RH_ADV_DISP,      LED_DISP,     NVIS_GREEN_A, NVIS_BLACK},
+    {FA_18C_hornet_RH_ADV_RCDR_ON,   LED_RCDRON,   NVIS_GREEN_A, NVIS_BLACK},
+    {FA_18C_hornet_RH_ADV_SAM,       LED_SAM,      NVIS_GREEN_A, NVIS_BLACK},
+    {FA_18C_hornet_RH_ADV_SPARE_RH1, LED_SPARE1,   NVIS_GREEN_A, NVIS_BLACK},
+    {FA_18C_hornet_RH_ADV_SPARE_RH2, LED_SPARE2,   NVIS_GREEN_A, NVIS_BLACK},
+    {FA_18C_hornet_RH_ADV_SPARE_RH3, LED_SPARE3,   NVIS_GREEN_A, NVIS_BLACK},
+    {FA_18C_hornet_RH_ADV_SPARE_RH4, LED_SPARE4,   NVIS_GREEN_A, NVIS_BLACK},
+    {FA_18C_hornet_RH_ADV_SPARE_RH5, LED_SPARE5,   NVIS_GREEN_A, NVIS_BLACK}
 };
 
 /********************************************************************************************************************
@@ -64,9 +87,10 @@ public:
      * @return Pointer to the singleton instance
      * @see This method is called by the main .ino file's addPanel() method to create the panel instance
      */
-    static REwiPanel* getInstance(int startIndex = 0, CRGB* ledStrip = nullptr) {
+    static REwiPanel* getInstance(int startIndex = 0, uint8_t* ledStrip = nullptr) {
         if (!instance) {
-            instance = new REwiPanel(startIndex, ledStrip);
+            static REwiPanel panel(startIndex, ledStrip);
+            instance = &panel;                                        // Static storage, no heap allocation
         }
         return instance;
     }
@@ -78,82 +102,15 @@ private:
      * @param ledStrip Pointer to the LED strip array
      * @see This method is called by the public getInstance() if and only if no instance exists yet
      */
-    REwiPanel(int startIndex, CRGB* ledStrip) {
+    REwiPanel(int startIndex, uint8_t* ledStrip) {
         panelStartIndex = startIndex;
         this->ledStrip = ledStrip;
         ledCount = R_EWI_LED_COUNT;
-        ledTable = rEwiLedTable;
-    }
-
-    /**
-     * @brief Callback for FIRE RIGHT indicator
-     * @param newValue The new state of the indicator (0 or 1)
-     * @see This method is called by DCS-BIOS when the FIRE RIGHT indicator state changes
-     */
-    static void onFireRightLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_R_FIRE, newValue ? NVIS_RED : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer fireRightLtBuffer{FA_18C_hornet_FIRE_RIGHT_LT, onFireRightLtChange};
-
-    static void onFireApuLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_APU_FIRE, newValue ? NVIS_RED : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer fireApuLtBuffer{FA_18C_hornet_FIRE_APU_LT, onFireApuLtChange};
-
-    static void onRhAdvAaaChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_AAA, newValue ? NVIS_GREEN_A : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer rhAdvAaaBuffer{FA_18C_hornet_RH_ADV_AAA, onRhAdvAaaChange};
-
-    static void onRhAdvAiChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_AI, newValue ? NVIS_GREEN_A : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer rhAdvAiBuffer{FA_18C_hornet_RH_ADV_AI, onRhAdvAiChange};
-
-    static void onRhAdvCwChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_CW, newValue ? NVIS_GREEN_A : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer rhAdvCwBuffer{FA_18C_hornet_RH_ADV_CW, onRhAdvCwChange};
-
-    static void onRhAdvDispChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_DISP, newValue ? NVIS_GREEN_A : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer rhAdvDispBuffer{FA_18C_hornet_RH_ADV_DISP, onRhAdvDispChange};
-
-    static void onRhAdvRcdrOnChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_RCDRON, newValue ? NVIS_GREEN_A : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer rhAdvRcdrOnBuffer{FA_18C_hornet_RH_ADV_RCDR_ON, onRhAdvRcdrOnChange};
-
-    static void onRhAdvSamChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_SAM, newValue ? NVIS_GREEN_A : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer rhAdvSamBuffer{FA_18C_hornet_RH_ADV_SAM, onRhAdvSamChange};
-
-    static void onRhAdvSpareRh1Change(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_SPARE1, newValue ? NVIS_GREEN_A : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer rhAdvSpareRh1Buffer{FA_18C_hornet_RH_ADV_SPARE_RH1, onRhAdvSpareRh1Change};
-
-    static void onRhAdvSpareRh2Change(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_SPARE2, newValue ? NVIS_GREEN_A : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer rhAdvSpareRh2Buffer{FA_18C_hornet_RH_ADV_SPARE_RH2, onRhAdvSpareRh2Change};
-
-    static void onRhAdvSpareRh3Change(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_SPARE3, newValue ? NVIS_GREEN_A : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer rhAdvSpareRh3Buffer{FA_18C_hornet_RH_ADV_SPARE_RH3, onRhAdvSpareRh3Change};
-
-    static void onRhAdvSpareRh4Change(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_SPARE4, newValue ? NVIS_GREEN_A : NVIS_BLACK);
+        setLedRuns(rEwiLedRuns);
     }
-    DcsBios::IntegerBuffer rhAdvSpareRh4Buffer{FA_18C_hornet_RH_ADV_SPARE_RH4, onRhAdvSpareRh4Change};
 
-    static void onRhAdvSpareRh5Change(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_SPARE5, newValue ? NVIS_GREEN_A : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer rhAdvSpareRh5Buffer{FA_18C_hornet_RH_ADV_SPARE_RH5, onRhAdvSpareRh5Change};
+    // DCS-BIOS indicator outputs, served by one listener (see rEwiIndicators above)
+    IndicatorBindings indicators{this, rEwiIndicators};
 
     // Instance data
     static REwiPanel* instance;
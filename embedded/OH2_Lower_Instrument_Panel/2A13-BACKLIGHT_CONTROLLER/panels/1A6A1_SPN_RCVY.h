@@ -29,27 +29,18 @@
 
 
 /********************************************************************************************************************
- * @brief   This table defines the panel's LEDs.
+ * @brief   This table defines the panel's LEDs as runs of consecutive LEDs sharing a role.
  * @details "Role" in this context refers to the LED role enum in the LedRole.h file (enum used for memory efficiency).
  * @remark  This table is stored in PROGMEM for memory efficiency.
- * @see     LedRole.h for the list of LED roles and LedStruct.h for the Led structure.
+ * @see     LedRole.h for the list of LED roles and LedStruct.h for the LedRun structure.
  ********************************************************************************************************************/
 const int SPN_RCVY_LED_COUNT = 63;  // Total number of LEDs in the panel
-const Led spnRcvyLedTable[SPN_RCVY_LED_COUNT] PROGMEM = {
-    {0, LED_INSTR_BL}, {1, LED_INSTR_BL}, {2, LED_INSTR_BL}, {3, LED_INSTR_BL}, {4, LED_INSTR_BL}, 
-    {5, LED_INSTR_BL}, {6, LED_INSTR_BL}, {7, LED_INSTR_BL}, {8, LED_INSTR_BL}, {9, LED_INSTR_BL},
-    {10, LED_INSTR_BL}, {11, LED_INSTR_BL}, {12, LED_INSTR_BL}, {13, LED_INSTR_BL}, {14, LED_INSTR_BL}, 
-    {15, LED_INSTR_BL}, {16, LED_INSTR_BL}, {17, LED_INSTR_BL}, {18, LED_INSTR_BL}, {19, LED_INSTR_BL},
-    {20, LED_INSTR_BL}, {21, LED_INSTR_BL}, {22, LED_INSTR_BL}, {23, LED_INSTR_BL}, {24, LED_INSTR_BL}, 
-    {25, LED_INSTR_BL}, {26, LED_INSTR_BL}, {27, LED_INSTR_BL}, {28, LED_INSTR_BL}, {29, LED_SPIN},
-    {30, LED_INSTR_BL}, {31, LED_INSTR_BL}, {32, LED_INSTR_BL}, {33, LED_INSTR_BL}, {34, LED_INSTR_BL}, 
-    {35, LED_INSTR_BL}, {36, LED_SPIN}, {37, LED_INSTR_BL}, {38, LED_INSTR_BL}, {39, LED_INSTR_BL},
-    {40, LED_INSTR_BL}, {41, LED_INSTR_BL}, {42, LED_INSTR_BL}, {43, LED_INSTR_BL}, {44, LED_INSTR_BL}, 
-    {45, LED_INSTR_BL}, {46, LED_INSTR_BL}, {47, LED_INSTR_BL}, {48, LED_INSTR_BL}, {49, LED_INSTR_BL},
-    {50, LED_INSTR_BL}, {51, LED_INSTR_BL}, {52, LED_INSTR_BL}, {53, LED_INSTR_BL}, {54, LED_INSTR_BL}, 
-    {55, LED_INSTR_BL}, {56, LED_INSTR_BL}, {57, LED_INSTR_BL}, {58, LED_INSTR_BL}, {59, LED_INSTR_BL},
-    {60, LED_INSTR_BL}, {61, LED_INSTR_BL}, {62, LED_INSTR_BL}
+constexpr LedRun spnRcvyLedRuns[] PROGMEM = {
+    {0, 29, LED_INSTR_BL}, {29, 1, LED_SPIN},
+    {30, 6, LED_INSTR_BL}, {36, 1, LED_SPIN},
+    {37, 26, LED_INSTR_BL}
 };
+static_assert(ledRunsValid(spnRcvyLedRuns, SPN_RCVY_LED_COUNT), "spnRcvyLedRuns overlap or exceed SPN_RCVY_LED_COUNT");
 
 /********************************************************************************************************************
  * @brief   Spin Recovery Panel class
@@ -70,9 +61,10 @@ public:
      * @return Pointer to the singleton instance
      * @see This method is called by the main .ino file's addPanel() method to create the panel instance
      */
-    static SpnRcvyPanel* getInstance(int startIndex = 0, CRGB* ledStrip = nullptr) {
+    static SpnRcvyPanel* getInstance(int startIndex = 0, uint8_t* ledStrip = nullptr) {
         if (!instance) {
-            instance = new SpnRcvyPanel(startIndex, ledStrip);
+            static SpnRcvyPanel panel(startIndex, ledStrip);
+            instance = &panel;                                        // Static storage, no heap allocation
         }
         return instance;
     }
@@ -84,11 +76,11 @@ private:
      * @param ledStrip Pointer to the LED strip array
      * @see This method is called by the public getInstance() if and only if no instance exists yet
      */
-    SpnRcvyPanel(int startIndex, CRGB* ledStrip) {
+    SpnRcvyPanel(int startIndex, uint8_t* ledStrip) {
         panelStartIndex = startIndex;
         this->ledStrip = ledStrip;
         ledCount = SPN_RCVY_LED_COUNT;
-        ledTable = spnRcvyLedTable;
+        setLedRuns(spnRcvyLedRuns);
     }
 
     /**
@@ -29,38 +29,63 @@
 
 
 /********************************************************************************************************************
- * @brief   This table defines the panel's LEDs.
+ * @brief   This table defines the panel's LEDs as runs of consecutive LEDs sharing a role.
  * @details "Role" in this context refers to the LED role enum in the LedRole.h file (enum used for memory efficiency).
  * @remark  This table is stored in PROGMEM for memory efficiency.
- * @see     LedRole.h for the list of LED roles and LedStruct.h for the Led structure.
+ * @see     LedRole.h for the list of LED roles and LedStruct.h for the LedRun structure.
  ********************************************************************************************************************/
 const int JETT_STATION_LED_COUNT = 32;  // Total number of LEDs in the panel
-const Led jettStationLedTable[JETT_STATION_LED_COUNT] PROGMEM = {
+constexpr LedRun jettStationLedRuns[] PROGMEM = {
     // RO (Right Outer) Station LEDs
-    {0, LED_JETT_RO_1}, {3, LED_JETT_RO_1}, {1, LED_JETT_RO_2}, {2, LED_JETT_RO_2},
+    {0, 1, LED_JETT_RO_1}, {3, 1, LED_JETT_RO_1}, {1, 2, LED_JETT_STATION_BL},
     // RI (Right Inner) Station LEDs
-    {4, LED_JETT_RI_1}, {7, LED_JETT_RI_1}, {5, LED_JETT_RI_2}, {6, LED_JETT_RI_2},
+    {4, 1, LED_JETT_RI_1}, {7, 1, LED_JETT_RI_1}, {5, 2, LED_JETT_STATION_BL},
     // CTR (Center) Station LEDs
-    {11, LED_JETT_CTR_1}, {8, LED_JETT_CTR_1}, {10, LED_JETT_CTR_2}, {9, LED_JETT_CTR_2},
+    {11, 1, LED_JETT_CTR_1}, {8, 1, LED_JETT_CTR_1}, {10, 1, LED_JETT_STATION_BL}, {9, 1, LED_JETT_STATION_BL},
     // LI (Left Inner) Station LEDs
-    {14, LED_JETT_LI_1}, {13, LED_JETT_LI_1}, {12, LED_JETT_LI_2}, {15, LED_JETT_LI_2},
+    {14, 1, LED_JETT_LI_1}, {13, 1, LED_JETT_LI_1}, {12, 1, LED_JETT_STATION_BL}, {15, 1, LED_JETT_STATION_BL},
     // LO (Left Outer) Station LEDs
-    {18, LED_JETT_LO_1}, {17, LED_JETT_LO_1}, {16, LED_JETT_LO_2}, {19, LED_JETT_LO_2},
+    {18, 1, LED_JETT_LO_1}, {17, 1, LED_JETT_LO_1}, {16, 1, LED_JETT_STATION_BL}, {19, 1, LED_JETT_STATION_BL},
     // Nose Station LED
-    {20, LED_JETT_NOSE}, {31, LED_JETT_NOSE},
+    {20, 1, LED_JETT_NOSE}, {31, 1, LED_JETT_NOSE},
     // Left/Right Station LEDs
-    {23, LED_JETT_LEFT}, {24, LED_JETT_LEFT}, {21, LED_JETT_RIGHT}, {22, LED_JETT_RIGHT},
+    {23, 2, LED_JETT_LEFT}, {21, 2, LED_JETT_RIGHT},
     // Half/Full Station LEDs
-    {25, LED_JETT_HALF}, {26, LED_JETT_HALF}, {27, LED_JETT_FULL}, {28, LED_JETT_FULL},
+    {25, 2, LED_JETT_HALF}, {27, 2, LED_JETT_FULL},
     // Flaps Station LEDs
-    {29, LED_JETT_FLAPS}, {30, LED_JETT_FLAPS}
+    {29, 2, LED_JETT_FLAPS}
+};
+static_assert(ledRunsValid(jettStationLedRuns, JETT_STATION_LED_COUNT), "jettStationLedRuns overlap or exceed JETT_STATION_LED_COUNT");
+
+/********************************************************************************************************************
+ * @brief   This table binds the panel's indicator LEDs to their DCS-BIOS outputs.
+ * @details Each entry sets the LEDs of one role to the first color while the indicator is on, else to the second.
+ * @remark  This table is stored in PROGMEM for memory efficiency.
+ * @see     Panel.h for the IndicatorBinding structure.
+ ********************************************************************************************************************/
+constexpr IndicatorBinding jettStationIndicators[] PROGMEM = {
+    // STATION JETTISON SELECT panel indicators
+    {FA_18C_hornet_SJ_RO_LT,             LED_JETT_RO_1,  NVIS_WHITE,   NVIS_BLACK},
+    {FA_18C_hornet_SJ_RI_LT,             LED_JETT_RI_1,  NVIS_WHITE,   NVIS_BLACK},
+    {FA_18C_hornet_SJ_CTR_LT,            LED_JETT_CTR_1, NVIS_WHITE,   NVIS_BLACK},
+    {FA_18C_hornet_SJ_LI_LT,             LED_JETT_LI_1,  NVIS_WHITE,   NVIS_BLACK},
+    {FA_18C_hornet_SJ_LO_LT,             LED_JETT_LO_1,  NVIS_WHITE,   NVIS_BLACK},
+    // STORES INDICATOR panel
+    {FA_18C_hornet_FLP_LG_NOSE_GEAR_LT,  LED_JETT_NOSE,  NVIS_GREEN_A, NVIS_BLACK},
+    {FA_18C_hornet_FLP_LG_RIGHT_GEAR_LT, LED_JETT_RIGHT, NVIS_GREEN_A, NVIS_BLACK},
+    {FA_18C_hornet_FLP_LG_LEFT_GEAR_LT,  LED_JETT_LEFT,  NVIS_GREEN_A, NVIS_BLACK},
+    {FA_18C_hornet_FLP_LG_HALF_FLAPS_LT, LED_JETT_HALF,  NVIS_GREEN_A, NVIS_BLACK},
+    {FA_18C_hornet_FLP_LG_FULL_FLAPS_LT, LED_JETT_FULL,  NVIS_GREEN_A, NVIS_BLACK},
+    {FA_18C_hornet_FLP_LG_FLAPS_LT,      LED_JETT_FLAPS, NVIS_YELLOW,  NVIS_BLACK}
 };
 
 /********************************************************************************************************************
  * @brief   Jett Station Panel class
  * @details Indicator controller for the Jett Station panel.
  *          Total LEDs: 32
- *          Indicator LEDs: 32 (various jettison station indicators)
+ *          Indicator LEDs: 22 (various jettison station indicators)
+ *          Station select lights: 10 (upper LEDs of RO, RI, CTR, LI, LO), colored by the cockpit light mode
+ *          (see Board::setLightMode()) and lit while the instrument lights are on
  * @remark  This class inherits from the "basic" Panel class in panels/Panel.h
  *          It also enforces a singleton pattern; this is required to use DCS-BIOS callbacks in class methods.
  * @see     Panel.h for the base class implementation
@@ -74,9 +99,10 @@ public:
      * @return Pointer to the singleton instance
      * @see This method is called by the main .ino file's addPanel() method to create the panel instance
      */
-    static JettStationPanel* getInstance(int startIndex = 0, CRGB* ledStrip = nullptr) {
+    static JettStationPanel* getInstance(int startIndex = 0, uint8_t* ledStrip = nullptr) {
         if (!instance) {
-            instance = new JettStationPanel(startIndex, ledStrip);
+            static JettStationPanel panel(startIndex, ledStrip);
+            instance = &panel;                                        // Static storage, no heap allocation
         }
         return instance;
     }
@@ -88,112 +114,15 @@ private:
      * @param ledStrip Pointer to the LED strip array
      * @see This method is called by the public getInstance() if and only if no instance exists yet
      */
-    JettStationPanel(int startIndex, CRGB* ledStrip) {
+    JettStationPanel(int startIndex, uint8_t* ledStrip) {
         panelStartIndex = startIndex;
         this->ledStrip = ledStrip;
         ledCount = JETT_STATION_LED_COUNT;
-        ledTable = jettStationLedTable;
-    }
-
-    // Static callback functions for DCS-BIOS
-
-    // STATION JETTISON SELECT panel indicators
-    static void onSjRoLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_JETT_RO_1, newValue ? NVIS_WHITE : NVIS_BLACK);
+        setLedRuns(jettStationLedRuns);
     }
-    DcsBios::IntegerBuffer sjRoLtBuffer{FA_18C_hornet_SJ_RO_LT, onSjRoLtChange};
 
-    static void onSjRiLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_JETT_RI_1, newValue ? NVIS_WHITE : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer sjRiLtBuffer{FA_18C_hornet_SJ_RI_LT, onSjRiLtChange};
-
-    static void onSjCtrLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_JETT_CTR_1, newValue ? NVIS_WHITE : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer sjCtrLtBuffer{FA_18C_hornet_SJ_CTR_LT, onSjCtrLtChange};
-
-    static void onSjLiLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_JETT_LI_1, newValue ? NVIS_WHITE : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer sjLiLtBuffer{FA_18C_hornet_SJ_LI_LT, onSjLiLtChange};
-
-    static void onSjLoLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_JETT_LO_1, newValue ? NVIS_WHITE : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer sjLoLtBuffer{FA_18C_hornet_SJ_LO_LT, onSjLoLtChange};
-
-    // STORES INDICATOR panel
-    static void onFlpLgNoseGearLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_JETT_NOSE, newValue ? NVIS_GREEN_A : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer flpLgNoseGearLtBuffer{FA_18C_hornet_FLP_LG_NOSE_GEAR_LT, onFlpLgNoseGearLtChange};
-
-    static void onFlpLgRightGearLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_JETT_RIGHT, newValue ? NVIS_GREEN_A : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer flpLgRightGearLtBuffer{FA_18C_hornet_FLP_LG_RIGHT_GEAR_LT, onFlpLgRightGearLtChange};
-
-    static void onFlpLgLeftGearLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_JETT_LEFT, newValue ? NVIS_GREEN_A : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer flpLgLeftGearLtBuffer{FA_18C_hornet_FLP_LG_LEFT_GEAR_LT, onFlpLgLeftGearLtChange};
-
-    static void onFlpLgHalfFlapsLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_JETT_HALF, newValue ? NVIS_GREEN_A : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer flpLgHalfFlapsLtBuffer{FA_18C_hornet_FLP_LG_HALF_FLAPS_LT, onFlpLgHalfFlapsLtChange};
-
-    static void onFlpLgFullFlapsLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_JETT_FULL, newValue ? NVIS_GREEN_A : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer flpLgFullFlapsLtBuffer{FA_18C_hornet_FLP_LG_FULL_FLAPS_LT, onFlpLgFullFlapsLtChange};
-
-    static void onFlpLgFlapsLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_JETT_FLAPS, newValue ? NVIS_YELLOW : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer flpLgFlapsLtBuffer{FA_18C_hornet_FLP_LG_FLAPS_LT, onFlpLgFlapsLtChange};
-
-
-    // Member variables to track state
-    unsigned int cockpitLightMode = 0;  // 0=NVG, 1=NITE, 2=DAY
-    bool instrIntLtActive = false;       // Whether instrument lights are on
-
-    // Helper method to update LEDs based on both cockpit mode and instrument light state
-    void updateJettStationLeds() {
-        if (!instance) return;
-        
-        // Determine color based on cockpit light mode
-        // 2 = NVG, 1 = NITE -> NVIS_GREEN_A
-        // 0 = DAY -> NVIS_WHITE
-        CRGB activeColor = (cockpitLightMode >= 1) ? NVIS_GREEN_A : NVIS_WHITE;
-        CRGB targetColor = instrIntLtActive ? activeColor : NVIS_BLACK;
-        
-        instance->setIndicatorColor(LED_JETT_RO_2, targetColor);
-        instance->setIndicatorColor(LED_JETT_RI_2, targetColor);
-        instance->setIndicatorColor(LED_JETT_CTR_2, targetColor);
-        instance->setIndicatorColor(LED_JETT_LI_2, targetColor);
-        instance->setIndicatorColor(LED_JETT_LO_2, targetColor);
-    }
-
-    // Controlling the upper LEDs (RO_2, RI_2, CTR_2, LI_2, LO_2)
-    // These are controlled by backlight brightness value from DCS BIOS
-    // and the cockpit light mode (NVG/NITE vs DAY)
-    static void onInstrIntLtChange(unsigned int newValue) {
-        if (instance) {
-            instance->instrIntLtActive = (newValue > 0);
-            instance->updateJettStationLeds();
-        }
-    }
-    DcsBios::IntegerBuffer instrIntLtBuffer{FA_18C_hornet_INSTR_INT_LT, onInstrIntLtChange};
-
-    static void onCockkpitLightModeSwChange(unsigned int newValue) {
-        if (instance) {
-            instance->cockpitLightMode = newValue;
-            instance->updateJettStationLeds();
-        }
-    }
-    DcsBios::IntegerBuffer cockkpitLightModeSwBuffer{FA_18C_hornet_COCKKPIT_LIGHT_MODE_SW, onCockkpitLightModeSwChange};
+    // DCS-BIOS indicator outputs, served by one listener (see jettStationIndicators above)
+    IndicatorBindings indicators{this, jettStationIndicators};
 
     // Instance data
     static JettStationPanel* instance;
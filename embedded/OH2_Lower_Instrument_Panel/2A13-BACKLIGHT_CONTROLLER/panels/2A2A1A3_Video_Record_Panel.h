@@ -29,18 +29,16 @@
 
 
 /********************************************************************************************************************
- * @brief   This table defines the panel's LEDs.
+ * @brief   This table defines the panel's LEDs as runs of consecutive LEDs sharing a role.
  * @details "Role" in this context refers to the LED role enum in the LedRole.h file (enum used for memory efficiency).
  * @remark  This table is stored in PROGMEM for memory efficiency.
- * @see     LedRole.h for the list of LED roles and LedStruct.h for the Led structure.
+ * @see     LedRole.h for the list of LED roles and LedStruct.h for the LedRun structure.
  ********************************************************************************************************************/
 const int VIDEO_RECORD_LED_COUNT = 16;  // Total number of LEDs in the panel
-const Led videoRecordLedTable[VIDEO_RECORD_LED_COUNT] PROGMEM = {
-    {0, LED_INSTR_BL}, {1, LED_INSTR_BL}, {2, LED_INSTR_BL}, {3, LED_INSTR_BL}, {4, LED_INSTR_BL}, 
-    {5, LED_INSTR_BL}, {6, LED_INSTR_BL}, {7, LED_INSTR_BL}, {8, LED_INSTR_BL}, {9, LED_INSTR_BL},
-    {10, LED_INSTR_BL}, {11, LED_INSTR_BL}, {12, LED_INSTR_BL}, {13, LED_INSTR_BL}, {14, LED_INSTR_BL}, 
-    {15, LED_INSTR_BL}
+constexpr LedRun videoRecordLedRuns[] PROGMEM = {
+    {0, 16, LED_INSTR_BL}
 };
+static_assert(ledRunsValid(videoRecordLedRuns, VIDEO_RECORD_LED_COUNT), "videoRecordLedRuns overlap or exceed VIDEO_RECORD_LED_COUNT");
 
 /********************************************************************************************************************
  * @brief   Video Record Panel class
@@ -61,19 +59,14 @@ public:
      * @return Pointer to the singleton instance
      * @see This method is called by the main .ino file's addPanel() method to create the panel instance
      */
-    static VideoRecordPanel* getInstance(int startIndex = 0, CRGB* ledStrip = nullptr) {
+    static VideoRecordPanel* getInstance(int startIndex = 0, uint8_t* ledStrip = nullptr) {
         if (!instance) {
-            instance = new VideoRecordPanel(startIndex, ledStrip);
+            static VideoRecordPanel panel(startIndex, ledStrip);
+            instance = &panel;                                        // Static storage, no heap allocation
         }
         return instance;
     }
 
-    // Explicitly override virtual methods from base class
-    //int getStartIndex() const override { return panelStartIndex; }
-    //int getLedCount() const override { return ledCount; }
-    //const Led* getLedTable() const override { return ledTable; }
-    //CRGB* getLedStrip() const override { return ledStrip; }
-
 private:
     /**
      * @brief Private constructor to enforce singleton pattern
@@ -81,11 +74,11 @@ private:
      * @param ledStrip Pointer to the LED strip array
      * @see This method is called by the public getInstance() if and only if no instance exists yet
      */
-    VideoRecordPanel(int startIndex, CRGB* ledStrip) {
+    VideoRecordPanel(int startIndex, uint8_t* ledStrip) {
         panelStartIndex = startIndex;
         this->ledStrip = ledStrip;
         ledCount = VIDEO_RECORD_LED_COUNT;
-        ledTable = videoRecordLedTable;
+        setLedRuns(videoRecordLedRuns);
     }
 
     // Static callback functions for DCS-BIOS
@@ -29,16 +29,16 @@
 
 
 /********************************************************************************************************************
- * @brief   This table defines the panel's LEDs.
+ * @brief   This table defines the panel's LEDs as runs of consecutive LEDs sharing a role.
  * @details "Role" in this context refers to the LED role enum in the LedRole.h file (enum used for memory efficiency).
  * @remark  This table is stored in PROGMEM for memory efficiency.
- * @see     LedRole.h for the list of LED roles and LedStruct.h for the Led structure.
+ * @see     LedRole.h for the list of LED roles and LedStruct.h for the LedRun structure.
  ********************************************************************************************************************/
 const int JETT_PLACARD_LED_COUNT = 8;  // Total number of LEDs in the panel
-const Led jettPlacardLedTable[JETT_PLACARD_LED_COUNT] PROGMEM = {
-    {0, LED_INSTR_BL}, {1, LED_INSTR_BL}, {2, LED_INSTR_BL}, {3, LED_INSTR_BL},
-    {4, LED_INSTR_BL}, {5, LED_INSTR_BL}, {6, LED_INSTR_BL}, {7, LED_INSTR_BL}
+constexpr LedRun jettPlacardLedRuns[] PROGMEM = {
+    {0, 8, LED_INSTR_BL}
 };
+static_assert(ledRunsValid(jettPlacardLedRuns, JETT_PLACARD_LED_COUNT), "jettPlacardLedRuns overlap or exceed JETT_PLACARD_LED_COUNT");
 
 /********************************************************************************************************************
  * @brief   Jett Placard Panel class
@@ -59,9 +59,10 @@ public:
      * @return Pointer to the singleton instance
      * @see This method is called by the main .ino file's addPanel() method to create the panel instance
      */
-    static JettPlacardPanel* getInstance(int startIndex = 0, CRGB* ledStrip = nullptr) {
+    static JettPlacardPanel* getInstance(int startIndex = 0, uint8_t* ledStrip = nullptr) {
         if (!instance) {
-            instance = new JettPlacardPanel(startIndex, ledStrip);
+            static JettPlacardPanel panel(startIndex, ledStrip);
+            instance = &panel;                                        // Static storage, no heap allocation
         }
         return instance;
     }
@@ -73,11 +74,11 @@ private:
      * @param ledStrip Pointer to the LED strip array
      * @see This method is called by the public getInstance() if and only if no instance exists yet
      */
-    JettPlacardPanel(int startIndex, CRGB* ledStrip) {
+    JettPlacardPanel(int startIndex, uint8_t* ledStrip) {
         panelStartIndex = startIndex;
         this->ledStrip = ledStrip;
         ledCount = JETT_PLACARD_LED_COUNT;
-        ledTable = jettPlacardLedTable;
+        setLedRuns(jettPlacardLedRuns);
     }
 
     // Static callback functions for DCS-BIOS
@@ -29,22 +29,22 @@
 
 
 /********************************************************************************************************************
- * @brief   This table defines the panel's LEDs.
+ * @brief   This table defines the panel's LEDs as runs of consecutive LEDs sharing a role.
  * @details "Role" in this context refers to the LED role enum in the LedRole.h file (enum used for memory efficiency).
  * @remark  This table is stored in PROGMEM for memory efficiency.
- * @see     LedRole.h for the list of LED roles and LedStruct.h for the Led structure.
+ * @see     LedRole.h for the list of LED roles and LedStruct.h for the LedRun structure.
  ********************************************************************************************************************/
 const int RWR_CONTROL_LED_COUNT = 32;  // Total number of LEDs in the panel
-const Led rwrControlLedTable[RWR_CONTROL_LED_COUNT] PROGMEM = {
-    {0, LED_INSTR_BL}, {1, LED_INSTR_BL}, {2, LED_INSTR_BL}, {3, LED_INSTR_BL},
-    {4, LED_INSTR_BL}, {5, LED_INSTR_BL}, {6, LED_RWR_BIT}, {7, LED_RWR_BIT_FAIL},
-    {8, LED_RWR_BIT_FAIL}, {9, LED_RWR_BIT}, {10, LED_RWR_OFFSET}, {11, LED_RWR_OFFSET_EN},
-    {12, LED_RWR_OFFSET_EN}, {13, LED_RWR_OFFSET}, {14, LED_RWR_SPECIAL}, {15, LED_RWR_SPECIAL_EN},
-    {16, LED_RWR_SPECIAL_EN}, {17, LED_RWR_SPECIAL}, {18, LED_RWR_DISPLAY}, {19, LED_RWR_LIMIT},
-    {20, LED_RWR_LIMIT}, {21, LED_RWR_DISPLAY}, {22, LED_RWR_POWER}, {23, LED_RWR_POWER},
-    {24, LED_RWR_NONE}, {25, LED_RWR_NONE}, {26, LED_INSTR_BL}, {27, LED_INSTR_BL},
-    {28, LED_INSTR_BL}, {29, LED_INSTR_BL}, {30, LED_INSTR_BL}, {31, LED_INSTR_BL}
+constexpr LedRun rwrControlLedRuns[] PROGMEM = {
+    {0, 6, LED_INSTR_BL}, {6, 1, LED_RWR_BIT},
+    {7, 2, LED_RWR_BIT_FAIL}, {9, 1, LED_RWR_BIT}, {10, 1, LED_RWR_OFFSET},
+    {11, 2, LED_RWR_OFFSET_EN}, {13, 1, LED_RWR_OFFSET}, {14, 1, LED_RWR_SPECIAL},
+    {15, 2, LED_RWR_SPECIAL_EN}, {17, 1, LED_RWR_SPECIAL}, {18, 1, LED_RWR_DISPLAY},
+    {19, 2, LED_RWR_LIMIT}, {21, 1, LED_RWR_DISPLAY}, {22, 2, LED_RWR_POWER},
+    {24, 2, LED_RWR_NONE},
+    {26, 6, LED_INSTR_BL}
 };
+static_assert(ledRunsValid(rwrControlLedRuns, RWR_CONTROL_LED_COUNT), "rwrControlLedRuns overlap or exceed RWR_CONTROL_LED_COUNT");
 
 /********************************************************************************************************************
  * @brief   RWR Control Panel class
@@ -65,9 +65,10 @@ public:
      * @return Pointer to the singleton instance
      * @see This method is called by the main .ino file's addPanel() method to create the panel instance
      */
-    static RwrControlPanel* getInstance(int startIndex = 0, CRGB* ledStrip = nullptr) {
+    static RwrControlPanel* getInstance(int startIndex = 0, uint8_t* ledStrip = nullptr) {
         if (!instance) {
-            instance = new RwrControlPanel(startIndex, ledStrip);
+            static RwrControlPanel panel(startIndex, ledStrip);
+            instance = &panel;                                        // Static storage, no heap allocation
         }
         return instance;
     }
@@ -79,11 +80,11 @@ private:
      * @param ledStrip Pointer to the LED strip array
      * @see This method is called by the public getInstance() if and only if no instance exists yet
      */
-    RwrControlPanel(int startIndex, CRGB* ledStrip) {
+    RwrControlPanel(int startIndex, uint8_t* ledStrip) {
         panelStartIndex = startIndex;
         this->ledStrip = ledStrip;
         ledCount = RWR_CONTROL_LED_COUNT;
-        ledTable = rwrControlLedTable;
+        setLedRuns(rwrControlLedRuns);
         
         // Initialize state variables
         rwrPanelOn = false;
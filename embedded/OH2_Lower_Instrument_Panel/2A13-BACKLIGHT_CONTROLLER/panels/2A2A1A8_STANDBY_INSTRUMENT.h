@@ -32,15 +32,15 @@
 const int STANDBY_INSTRUMENT_LED_COUNT = 6;
 
 /********************************************************************************************************************
- * @brief   This table defines the panel's LEDs.
+ * @brief   This table defines the panel's LEDs as runs of consecutive LEDs sharing a role.
  * @details "Role" in this context refers to the LED role enum in the LedRole.h file (enum used for memory efficiency).
  * @remark  This table is stored in PROGMEM for memory efficiency.
- * @see     LedRole.h for the list of LED roles and LedStruct.h for the Led structure.
+ * @see     LedRole.h for the list of LED roles and LedStruct.h for the LedRun structure.
  ********************************************************************************************************************/
-const Led standbyInstrumentLedTable[STANDBY_INSTRUMENT_LED_COUNT] PROGMEM = {
-    {0, LED_INSTR_BL_CGRB}, {1, LED_INSTR_BL_CGRB}, {2, LED_INSTR_BL_CGRB},
-    {3, LED_INSTR_BL_CGRB}, {4, LED_INSTR_BL_CGRB}, {5, LED_INSTR_BL_CGRB}
+constexpr LedRun standbyInstrumentLedRuns[] PROGMEM = {
+    {0, 6, LED_INSTR_BL}
 };
+static_assert(ledRunsValid(standbyInstrumentLedRuns, STANDBY_INSTRUMENT_LED_COUNT), "standbyInstrumentLedRuns overlap or exceed STANDBY_INSTRUMENT_LED_COUNT");
 
 /********************************************************************************************************************
  * @brief   Standby Instrument Panel class
@@ -60,9 +60,10 @@ public:
      * @return Pointer to the singleton instance
      * @see This method is called by the main .ino file's addPanel() method to create the panel instance
      */
-    static StandbyInstrumentPanel* getInstance(int startIndex = 0, CRGB* ledStrip = nullptr) {
+    static StandbyInstrumentPanel* getInstance(int startIndex = 0, uint8_t* ledStrip = nullptr) {
         if (!instance) {
-            instance = new StandbyInstrumentPanel(startIndex, ledStrip);
+            static StandbyInstrumentPanel panel(startIndex, ledStrip);
+            instance = &panel;                                        // Static storage, no heap allocation
         }
         return instance;
     }
@@ -75,21 +76,15 @@ private:
      * @param ledStrip Pointer to the LED strip array
      * @see This method is called by the public getInstance() if and only if no instance exists yet
      */
-    StandbyInstrumentPanel(int startIndex, CRGB* ledStrip) {
+    StandbyInstrumentPanel(int startIndex, uint8_t* ledStrip) {
         panelStartIndex = startIndex;
         this->ledStrip = ledStrip;
         ledCount = STANDBY_INSTRUMENT_LED_COUNT;
-        ledTable = standbyInstrumentLedTable;
+        setLedRuns(standbyInstrumentLedRuns);
     }
 
-    // Static callback functions for DCS-BIOS
-    static void onInstrIntLtChange(unsigned int newValue) {
-        int scale = map(newValue, 0, 65535, 0, 255);                  // Map the brightness scale factor to a range of 0-255
-        CRGB target = NVIS_CGRB_GREEN_A;                              // Use NVIS_CGRB_GREEN_A for GRB LEDs
-        target.nscale8_video(scale);                                  // Use FastLED's nscale8_video to apply the scale factor
-        if (instance) instance->setIndicatorColor(LED_INSTR_BL_CGRB, target);
-    }
-    DcsBios::IntegerBuffer instrIntLtBuffer{FA_18C_hornet_INSTR_INT_LT, onInstrIntLtChange};
+    // The backlights follow the instrument dimmer through Panel::setInstrLights(). The LEDs are RGB ordered,
+    // unlike the strip; this is declared when adding the panel: addPanel<StandbyInstrumentPanel>(RGB)
 
     // Instance data
     static StandbyInstrumentPanel* instance;
@@ -26,39 +26,15 @@
 #include "../helpers/Panel.h"
 
 /********************************************************************************************************************
- * @brief   This table defines the panel's LEDs.
+ * @brief   This table defines the panel's LEDs as runs of consecutive LEDs sharing a role.
  * @details "Role" in this context refers to the LED role enum in the Panel.h file (enum used for memory efficiency).
  * @remark  This table is stored in PROGMEM for memory efficiency.
  ********************************************************************************************************************/
 const int LC1_ALL_PANELS_LED_COUNT = 130;  // Total number of LEDs in the panel
-const Led lc1AllPanelsLedTable[LC1_ALL_PANELS_LED_COUNT] PROGMEM = {
-    {0, LED_CONSOLE_BL}, {1, LED_CONSOLE_BL}, {2, LED_CONSOLE_BL}, {3, LED_CONSOLE_BL}, {4, LED_CONSOLE_BL}, 
-    {5, LED_CONSOLE_BL}, {6, LED_CONSOLE_BL}, {7, LED_CONSOLE_BL}, {8, LED_CONSOLE_BL}, {9, LED_CONSOLE_BL},
-    {10, LED_CONSOLE_BL}, {11, LED_CONSOLE_BL}, {12, LED_CONSOLE_BL}, {13, LED_CONSOLE_BL}, {14, LED_CONSOLE_BL}, 
-    {15, LED_CONSOLE_BL}, {16, LED_CONSOLE_BL}, {17, LED_CONSOLE_BL}, {18, LED_CONSOLE_BL}, {19, LED_CONSOLE_BL},
-    {20, LED_CONSOLE_BL}, {21, LED_CONSOLE_BL}, {22, LED_CONSOLE_BL}, {23, LED_CONSOLE_BL}, {24, LED_CONSOLE_BL}, 
-    {25, LED_CONSOLE_BL}, {26, LED_CONSOLE_BL}, {27, LED_CONSOLE_BL}, {28, LED_CONSOLE_BL}, {29, LED_CONSOLE_BL},
-    {30, LED_CONSOLE_BL}, {31, LED_CONSOLE_BL}, {32, LED_CONSOLE_BL}, {33, LED_CONSOLE_BL}, {34, LED_CONSOLE_BL}, 
-    {35, LED_CONSOLE_BL}, {36, LED_CONSOLE_BL}, {37, LED_CONSOLE_BL}, {38, LED_CONSOLE_BL}, {39, LED_CONSOLE_BL},
-    {40, LED_CONSOLE_BL}, {41, LED_CONSOLE_BL}, {42, LED_CONSOLE_BL}, {43, LED_CONSOLE_BL}, {44, LED_CONSOLE_BL}, 
-    {45, LED_CONSOLE_BL}, {46, LED_CONSOLE_BL}, {47, LED_CONSOLE_BL}, {48, LED_CONSOLE_BL}, {49, LED_CONSOLE_BL},
-    {50, LED_CONSOLE_BL}, {51, LED_CONSOLE_BL}, {52, LED_CONSOLE_BL}, {53, LED_CONSOLE_BL}, {54, LED_CONSOLE_BL}, 
-    {55, LED_CONSOLE_BL}, {56, LED_CONSOLE_BL}, {57, LED_CONSOLE_BL}, {58, LED_CONSOLE_BL}, {59, LED_CONSOLE_BL},
-    {60, LED_CONSOLE_BL}, {61, LED_CONSOLE_BL}, {62, LED_CONSOLE_BL}, {63, LED_CONSOLE_BL}, {64, LED_CONSOLE_BL}, 
-    {65, LED_CONSOLE_BL}, {66, LED_CONSOLE_BL}, {67, LED_CONSOLE_BL}, {68, LED_CONSOLE_BL}, {69, LED_CONSOLE_BL},
-    {70, LED_CONSOLE_BL}, {71, LED_CONSOLE_BL}, {72, LED_CONSOLE_BL}, {73, LED_CONSOLE_BL}, {74, LED_CONSOLE_BL}, 
-    {75, LED_CONSOLE_BL}, {76, LED_CONSOLE_BL}, {77, LED_CONSOLE_BL}, {78, LED_CONSOLE_BL}, {79, LED_CONSOLE_BL},
-    {80, LED_CONSOLE_BL}, {81, LED_CONSOLE_BL}, {82, LED_CONSOLE_BL}, {83, LED_CONSOLE_BL}, {84, LED_CONSOLE_BL}, 
-    {85, LED_CONSOLE_BL}, {86, LED_CONSOLE_BL}, {87, LED_CONSOLE_BL}, {88, LED_CONSOLE_BL}, {89, LED_CONSOLE_BL},
-    {90, LED_CONSOLE_BL}, {91, LED_CONSOLE_BL}, {92, LED_CONSOLE_BL}, {93, LED_CONSOLE_BL}, {94, LED_CONSOLE_BL}, 
-    {95, LED_CONSOLE_BL}, {96, LED_CONSOLE_BL}, {97, LED_CONSOLE_BL}, {98, LED_CONSOLE_BL}, {99, LED_CONSOLE_BL},
-    {100, LED_CONSOLE_BL}, {101, LED_CONSOLE_BL}, {102, LED_CONSOLE_BL}, {103, LED_CONSOLE_BL}, {104, LED_CONSOLE_BL}, 
-    {105, LED_CONSOLE_BL}, {106, LED_CONSOLE_BL}, {107, LED_CONSOLE_BL}, {108, LED_CONSOLE_BL}, {109, LED_CONSOLE_BL},
-    {110, LED_CONSOLE_BL}, {111, LED_CONSOLE_BL}, {112, LED_CONSOLE_BL}, {113, LED_CONSOLE_BL}, {114, LED_CONSOLE_BL}, 
-    {115, LED_CONSOLE_BL}, {116, LED_CONSOLE_BL}, {117, LED_CONSOLE_BL}, {118, LED_CONSOLE_BL}, {119, LED_CONSOLE_BL},
-    {120, LED_CONSOLE_BL}, {121, LED_CONSOLE_BL}, {122, LED_CONSOLE_BL}, {123, LED_CONSOLE_BL}, {124, LED_CONSOLE_BL}, 
-    {125, LED_CONSOLE_BL}, {126, LED_CONSOLE_BL}, {127, LED_CONSOLE_BL}, {128, LED_CONSOLE_BL}, {129, LED_CONSOLE_BL}
+constexpr LedRun lc1AllPanelsLedRuns[] PROGMEM = {
+    {0, 130, LED_CONSOLE_BL}
 };
+static_assert(ledRunsValid(lc1AllPanelsLedRuns, LC1_ALL_PANELS_LED_COUNT), "lc1AllPanelsLedRuns overlap or exceed LC1_ALL_PANELS_LED_COUNT");
 
 /********************************************************************************************************************
  * @brief   Left Console 1 All Panels class
@@ -78,9 +54,10 @@ public:
      * @return Pointer to the singleton instance
      * @see This method is called by the main .ino file's addPanel() method to create the panel instance
      */
-    static Lc1AllPanels* getInstance(int startIndex = 0, CRGB* ledStrip = nullptr) {
+    static Lc1AllPanels* getInstance(int startIndex = 0, uint8_t* ledStrip = nullptr) {
         if (!instance) {
-            instance = new Lc1AllPanels(startIndex, ledStrip);
+            static Lc1AllPanels panel(startIndex, ledStrip);
+            instance = &panel;                                        // Static storage, no heap allocation
         }
         return instance;
     }
@@ -92,11 +69,11 @@ private:
      * @param ledStrip Pointer to the LED strip array
      * @see This method is called by the public getInstance() if and only if no instance exists yet
      */
-    Lc1AllPanels(int startIndex, CRGB* ledStrip) {
+    Lc1AllPanels(int startIndex, uint8_t* ledStrip) {
         panelStartIndex = startIndex;
         this->ledStrip = ledStrip;
         ledCount = LC1_ALL_PANELS_LED_COUNT;
-        ledTable = lc1AllPanelsLedTable;
+        setLedRuns(lc1AllPanelsLedRuns);
     }
 
     // Static callback functions for DCS-BIOS
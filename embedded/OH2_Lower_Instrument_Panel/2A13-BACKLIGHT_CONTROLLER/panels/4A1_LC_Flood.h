@@ -25,21 +25,15 @@
 #include "../helpers/Panel.h"
 
 /********************************************************************************************************************
- * @brief   This table defines the panel's LEDs.
+ * @brief   This table defines the panel's LEDs as runs of consecutive LEDs sharing a role.
  * @details "Role" in this context refers to the LED role enum in the Panel.h file (enum used for memory efficiency).
  * @remark  This table is stored in PROGMEM for memory efficiency.
  ********************************************************************************************************************/
 const int LCF_LED_COUNT = 40;  // Total number of LEDs in the panel
-const Led lcFloodLedTable[LCF_LED_COUNT] PROGMEM = {
-    {0, LED_FLOOD}, {1, LED_FLOOD}, {2, LED_FLOOD}, {3, LED_FLOOD}, {4, LED_FLOOD}, 
-    {5, LED_FLOOD}, {6, LED_FLOOD}, {7, LED_FLOOD}, {8, LED_FLOOD}, {9, LED_FLOOD},
-    {10, LED_FLOOD}, {11, LED_FLOOD}, {12, LED_FLOOD}, {13, LED_FLOOD}, {14, LED_FLOOD}, 
-    {15, LED_FLOOD}, {16, LED_FLOOD}, {17, LED_FLOOD}, {18, LED_FLOOD}, {19, LED_FLOOD},
-    {20, LED_FLOOD}, {21, LED_FLOOD}, {22, LED_FLOOD}, {23, LED_FLOOD}, {24, LED_FLOOD}, 
-    {25, LED_FLOOD}, {26, LED_FLOOD}, {27, LED_FLOOD}, {28, LED_FLOOD}, {29, LED_FLOOD},
-    {30, LED_FLOOD}, {31, LED_FLOOD}, {32, LED_FLOOD}, {33, LED_FLOOD}, {34, LED_FLOOD}, 
-    {35, LED_FLOOD}, {36, LED_FLOOD}, {37, LED_FLOOD}, {38, LED_FLOOD}, {39, LED_FLOOD}
+constexpr LedRun lcFloodLedRuns[] PROGMEM = {
+    {0, 40, LED_FLOOD}
 };
+static_assert(ledRunsValid(lcFloodLedRuns, LCF_LED_COUNT), "lcFloodLedRuns overlap or exceed LCF_LED_COUNT");
 
 /********************************************************************************************************************
  * @brief   Left Console Flood Lighting class
@@ -59,9 +53,10 @@ public:
      * @return Pointer to the singleton instance
      * @see This method is called by the main .ino file's addPanel() method to create the panel instance
      */
-    static LcFloodLights* getInstance(int startIndex = 0, CRGB* ledStrip = nullptr) {
+    static LcFloodLights* getInstance(int startIndex = 0, uint8_t* ledStrip = nullptr) {
         if (!instance) {
-            instance = new LcFloodLights(startIndex, ledStrip);
+            static LcFloodLights panel(startIndex, ledStrip);
+            instance = &panel;                                        // Static storage, no heap allocation
         }
         return instance;
     }
@@ -73,11 +68,11 @@ private:
      * @param ledStrip Pointer to the LED strip array
      * @see This method is called by the public getInstance() if and only if no instance exists yet
      */
-    LcFloodLights(int startIndex, CRGB* ledStrip) {
+    LcFloodLights(int startIndex, uint8_t* ledStrip) {
         panelStartIndex = startIndex;
         this->ledStrip = ledStrip;
         ledCount = LCF_LED_COUNT;
-        ledTable = lcFloodLedTable;
+        setLedRuns(lcFloodLedRuns);
     }
 
     // Instance data
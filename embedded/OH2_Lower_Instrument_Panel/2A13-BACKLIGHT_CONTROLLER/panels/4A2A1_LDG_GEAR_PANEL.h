@@ -23,18 +23,15 @@
 #include "../helpers/Panel.h"
 
 /********************************************************************************************************************
- * @brief   This table defines the panel's LEDs.
+ * @brief   This table defines the panel's LEDs as runs of consecutive LEDs sharing a role.
  * @details "Role" in this context refers to the LED role enum in the Panel.h file (enum used for memory efficiency).
  * @remark  This table is stored in PROGMEM for memory efficiency.
  ********************************************************************************************************************/
 const int LDG_GEAR_LED_COUNT = 23;  // Total number of LEDs in the panel
-const Led ldgGearLedTable[LDG_GEAR_LED_COUNT] PROGMEM = {
-    {0, LED_INSTR_BL}, {1, LED_INSTR_BL}, {2, LED_INSTR_BL}, {3, LED_INSTR_BL}, {4, LED_INSTR_BL},
-    {5, LED_INSTR_BL}, {6, LED_INSTR_BL}, {7, LED_INSTR_BL}, {8, LED_INSTR_BL}, {9, LED_INSTR_BL},
-    {10, LED_INSTR_BL}, {11, LED_INSTR_BL}, {12, LED_INSTR_BL}, {13, LED_INSTR_BL}, {14, LED_INSTR_BL},
-    {15, LED_INSTR_BL}, {16, LED_INSTR_BL}, {17, LED_INSTR_BL}, {18, LED_INSTR_BL}, {19, LED_INSTR_BL},
-    {20, LED_INSTR_BL}, {21, LED_INSTR_BL}, {22, LED_INSTR_BL}
+constexpr LedRun ldgGearLedRuns[] PROGMEM = {
+    {0, 23, LED_INSTR_BL}
 };
+static_assert(ledRunsValid(ldgGearLedRuns, LDG_GEAR_LED_COUNT), "ldgGearLedRuns overlap or exceed LDG_GEAR_LED_COUNT");
 
 /********************************************************************************************************************
  * @brief   Landing Gear Panel class
@@ -54,21 +51,14 @@ public:
      * @return Pointer to the singleton instance
      * @see This method is called by the main .ino file's addPanel() method to create the panel instance
      */
-    static LdgGearPanel* getInstance(int startIndex = 0, CRGB* ledStrip = nullptr) {
+    static LdgGearPanel* getInstance(int startIndex = 0, uint8_t* ledStrip = nullptr) {
         if (!instance) {
-            instance = new LdgGearPanel(startIndex, ledStrip);
+            static LdgGearPanel panel(startIndex, ledStrip);
+            instance = &panel;                                        // Static storage, no heap allocation
         }
         return instance;
     }
 
-    int getLedCount() const override {
-        return LDG_GEAR_LED_COUNT;
-    }
-
-    const Led* getLedTable() const override {
-        return ldgGearLedTable;
-    }
-
 private:
     /**
      * @brief Private constructor to enforce singleton pattern
@@ -76,11 +66,11 @@ private:
      * @param ledStrip Pointer to the LED strip array
      * @see This method is called by the public getInstance() if and only if no instance exists yet
      */
-    LdgGearPanel(int startIndex, CRGB* ledStrip) {
+    LdgGearPanel(int startIndex, uint8_t* ledStrip) {
         panelStartIndex = startIndex;
         this->ledStrip = ledStrip;
         ledCount = LDG_GEAR_LED_COUNT;
-        ledTable = ldgGearLedTable;
+        setLedRuns(ldgGearLedRuns);
     }
 
     // Static callback functions for DCS-BIOS
@@ -25,15 +25,15 @@
 #include "../helpers/Panel.h"
 
 /********************************************************************************************************************
- * @brief   This table defines the panel's LEDs.
+ * @brief   This table defines the panel's LEDs as runs of consecutive LEDs sharing a role.
  * @details "Role" in this context refers to the LED role enum in the Panel.h file (enum used for memory efficiency).
  * @remark  This table is stored in PROGMEM for memory efficiency.
  ********************************************************************************************************************/
 const int GEN_TIE_PANEL_LED_COUNT = 9;  // Total number of LEDs in the panel
-const Led genTiePanelLedTable[GEN_TIE_PANEL_LED_COUNT] PROGMEM = {
-    {0, LED_CONSOLE_BL}, {1, LED_CONSOLE_BL}, {2, LED_CONSOLE_BL}, {3, LED_CONSOLE_BL}, {4, LED_CONSOLE_BL}, 
-    {5, LED_CONSOLE_BL}, {6, LED_CONSOLE_BL}, {7, LED_CONSOLE_BL}, {8, LED_CONSOLE_BL}
+constexpr LedRun genTiePanelLedRuns[] PROGMEM = {
+    {0, 9, LED_CONSOLE_BL}
 };
+static_assert(ledRunsValid(genTiePanelLedRuns, GEN_TIE_PANEL_LED_COUNT), "genTiePanelLedRuns overlap or exceed GEN_TIE_PANEL_LED_COUNT");
 
 /********************************************************************************************************************
  * @brief   Gen Tie Panel class
@@ -53,9 +53,10 @@ public:
      * @return Pointer to the singleton instance
      * @see This method is called by the main .ino file's addPanel() method to create the panel instance
      */
-    static GenTiePanel* getInstance(int startIndex = 0, CRGB* ledStrip = nullptr) {
+    static GenTiePanel* getInstance(int startIndex = 0, uint8_t* ledStrip = nullptr) {
         if (!instance) {
-            instance = new GenTiePanel(startIndex, ledStrip);
+            static GenTiePanel panel(startIndex, ledStrip);
+            instance = &panel;                                        // Static storage, no heap allocation
         }
         return instance;
     }
@@ -67,11 +68,11 @@ private:
      * @param ledStrip Pointer to the LED strip array
      * @see This method is called by the public getInstance() if and only if no instance exists yet
      */
-    GenTiePanel(int startIndex, CRGB* ledStrip) {
+    GenTiePanel(int startIndex, uint8_t* ledStrip) {
         panelStartIndex = startIndex;
         this->ledStrip = ledStrip;
         ledCount = GEN_TIE_PANEL_LED_COUNT;
-        ledTable = genTiePanelLedTable;
+        setLedRuns(genTiePanelLedRuns);
     }
 
     // Static callback functions for DCS-BIOS
@@ -26,16 +26,15 @@
 
 
 /********************************************************************************************************************
- * @brief   This table defines the panel's LEDs.
+ * @brief   This table defines the panel's LEDs as runs of consecutive LEDs sharing a role.
  * @details "Role" in this context refers to the LED role enum in the Panel.h file (enum used for memory efficiency).
  * @remark  This table is stored in PROGMEM for memory efficiency.
  ********************************************************************************************************************/
 const int AVCOOL_LED_COUNT = 13;  // Total number of LEDs in the panel
-const Led avcoolLedTable[AVCOOL_LED_COUNT] PROGMEM = {
-    {0, LED_INSTR_BL}, {1, LED_INSTR_BL}, {2, LED_INSTR_BL}, {3, LED_INSTR_BL}, {4, LED_INSTR_BL},
-    {5, LED_INSTR_BL}, {6, LED_INSTR_BL}, {7, LED_INSTR_BL}, {8, LED_INSTR_BL}, {9, LED_INSTR_BL},
-    {10, LED_INSTR_BL}, {11, LED_INSTR_BL}, {12, LED_INSTR_BL}
+constexpr LedRun avcoolLedRuns[] PROGMEM = {
+    {0, 13, LED_INSTR_BL}
 };
+static_assert(ledRunsValid(avcoolLedRuns, AVCOOL_LED_COUNT), "avcoolLedRuns overlap or exceed AVCOOL_LED_COUNT");
 
 /********************************************************************************************************************
  * @brief   This table defines the optional legend text for specific backlight LEDs.
@@ -65,9 +64,10 @@ public:
      * @return Pointer to the singleton instance
      * @see This method is called by the main .ino file's addPanel() method to create the panel instance
      */
-    static AvcoolPanel* getInstance(int startIndex = 0, CRGB* ledStrip = nullptr) {
+    static AvcoolPanel* getInstance(int startIndex = 0, uint8_t* ledStrip = nullptr) {
         if (!instance) {
-            instance = new AvcoolPanel(startIndex, ledStrip);
+            static AvcoolPanel panel(startIndex, ledStrip);
+            instance = &panel;                                        // Static storage, no heap allocation
         }
         return instance;
     }
@@ -79,11 +79,11 @@ private:
      * @param ledStrip Pointer to the LED strip array
      * @see This method is called by the public getInstance() if and only if no instance exists yet
      */
-    AvcoolPanel(int startIndex, CRGB* ledStrip) {
+    AvcoolPanel(int startIndex, uint8_t* ledStrip) {
         panelStartIndex = startIndex;
         this->ledStrip = ledStrip;
         ledCount = AVCOOL_LED_COUNT;
-        ledTable = avcoolLedTable;
+        setLedRuns(avcoolLedRuns);
     }
 
     // Static callback functions for DCS-BIOS
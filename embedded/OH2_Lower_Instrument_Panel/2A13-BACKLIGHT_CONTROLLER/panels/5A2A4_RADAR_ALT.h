@@ -27,14 +27,15 @@
 
 
 /********************************************************************************************************************
- * @brief   This table defines the panel's LEDs.
+ * @brief   This table defines the panel's LEDs as runs of consecutive LEDs sharing a role.
  * @details "Role" in this context refers to the LED role enum in the Panel.h file (enum used for memory efficiency).
  * @remark  This table is stored in PROGMEM for memory efficiency.
  ********************************************************************************************************************/
 const int RADAR_ALT_LED_COUNT = 2;  // Total number of LEDs in the panel
-const Led radarAltLedTable[RADAR_ALT_LED_COUNT] PROGMEM = {
-    {0, LED_INSTR_BL_CGRB}, {1, LED_INSTR_BL_CGRB}
+constexpr LedRun radarAltLedRuns[] PROGMEM = {
+    {0, 2, LED_INSTR_BL}
 };
+static_assert(ledRunsValid(radarAltLedRuns, RADAR_ALT_LED_COUNT), "radarAltLedRuns overlap or exceed RADAR_ALT_LED_COUNT");
 
 /********************************************************************************************************************
  * @brief   This table defines the optional legend text for specific backlight LEDs.
@@ -64,9 +65,10 @@ public:
      * @return Pointer to the singleton instance
      * @see This method is called by the main .ino file's addPanel() method to create the panel instance
      */
-    static RadarAltPanel* getInstance(int startIndex = 0, CRGB* ledStrip = nullptr) {
+    static RadarAltPanel* getInstance(int startIndex = 0, uint8_t* ledStrip = nullptr) {
         if (!instance) {
-            instance = new RadarAltPanel(startIndex, ledStrip);
+            static RadarAltPanel panel(startIndex, ledStrip);
+            instance = &panel;                                        // Static storage, no heap allocation
         }
         return instance;
     }
@@ -78,23 +80,15 @@ private:
      * @param ledStrip Pointer to the LED strip array
      * @see This method is called by the public getInstance() if and only if no instance exists yet
      */
-    RadarAltPanel(int startIndex, CRGB* ledStrip) {
+    RadarAltPanel(int startIndex, uint8_t* ledStrip) {
         panelStartIndex = startIndex;
         this->ledStrip = ledStrip;
         ledCount = RADAR_ALT_LED_COUNT;
-        ledTable = radarAltLedTable;
+        setLedRuns(radarAltLedRuns);
     }
 
-    // Static callback functions for DCS-BIOS
-    static void onInstrIntLtChange(unsigned int newValue) {
-        int scale = map(newValue, 0, 65535, 0, 255);                  // Map the brightness scale factor to a range of 0-255
-        CRGB target = NVIS_CGRB_GREEN_A;                              // Use NVIS_CGRB_GREEN_A for GRB LEDs
-        target.nscale8_video(scale);                                  // Use FastLED's nscale8_video to apply the scale factor
-        if (instance) instance->setIndicatorColor(LED_INSTR_BL_CGRB, target);
-    }
-    DcsBios::IntegerBuffer instrIntLtBuffer{FA_18C_hornet_INSTR_INT_LT, onInstrIntLtChange};
-
-
+    // The backlights follow the instrument dimmer through Panel::setInstrLights(). The LEDs are RGB ordered,
+    // unlike the strip; this is declared when adding the panel: addPanel<RadarAltPanel>(RGB)
 
     // Instance data
     static RadarAltPanel* instance;
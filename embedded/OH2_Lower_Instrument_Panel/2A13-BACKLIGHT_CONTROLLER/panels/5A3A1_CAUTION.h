@@ -29,25 +29,26 @@
 
 
 /********************************************************************************************************************
- * @brief   This table defines the panel's LEDs.
+ * @brief   This table defines the panel's LEDs as runs of consecutive LEDs sharing a role.
  * @details "Role" in this context refers to the LED role enum in the Panel.h file (enum used for memory efficiency).
  * @remark  This table is stored in PROGMEM for memory efficiency.
  ********************************************************************************************************************/
 const int CAUTION_LED_COUNT = 24;  // Total number of LEDs in the panel
-const Led cautionLedTable[CAUTION_LED_COUNT] PROGMEM = {
-    {0, LED_CK_SEAT}, {1, LED_CK_SEAT},           // CK SEAT
-    {2, LED_APU_ACC}, {3, LED_APU_ACC},           // APU ACC
-    {4, LED_BATT_SW}, {5, LED_BATT_SW},           // BATT SW
-    {6, LED_FCS_HOT}, {7, LED_FCS_HOT},           // FCS HOT
-    {8, LED_GEN_TIE}, {9, LED_GEN_TIE},           // GEN TIE
-    {10, LED_CSPARE1}, {11, LED_CSPARE1},           // Spare1
-    {12, LED_FUEL_LO}, {13, LED_FUEL_LO},         // FUEL LO
-    {14, LED_FCES}, {15, LED_FCES},               // FCES
-    {16, LED_CSPARE2}, {17, LED_CSPARE2},           // Spare2
-    {18, LED_L_GEN}, {19, LED_L_GEN},             // L GEN
-    {20, LED_R_GEN}, {21, LED_R_GEN},             // R GEN
-    {22, LED_CSPARE3}, {23, LED_CSPARE3}            // Spare3
+constexpr LedRun cautionLedRuns[] PROGMEM = {
+    {0, 2, LED_CK_SEAT},                          // CK SEAT
+    {2, 2, LED_APU_ACC},                          // APU ACC
+    {4, 2, LED_BATT_SW},                          // BATT SW
+    {6, 2, LED_FCS_HOT},                          // FCS HOT
+    {8, 2, LED_GEN_TIE},                          // GEN TIE
+    {10, 2, LED_CSPARE1},                         // Spare1
+    {12, 2, LED_FUEL_LO},                         // FUEL LO
+    {14, 2, LED_FCES},                            // FCES
+    {16, 2, LED_CSPARE2},                         // Spare2
+    {18, 2, LED_L_GEN},                           // L GEN
+    {20, 2, LED_R_GEN},                           // R GEN
+    {22, 2, LED_CSPARE3}                          // Spare3
 };
+static_assert(ledRunsValid(cautionLedRuns, CAUTION_LED_COUNT), "cautionLedRuns overlap or exceed CAUTION_LED_COUNT");
 
 /********************************************************************************************************************
  * @brief   This table defines the optional legend text for specific backlight LEDs.
@@ -59,6 +60,27 @@ const LedText cautionTextTable[CAUTION_TEXT_COUNT] PROGMEM = {
     // No text needed for this panel
 };
 
+/********************************************************************************************************************
+ * @brief   This table binds the panel's indicator LEDs to their DCS-BIOS outputs.
+ * @details Each entry sets the LEDs of one role to the first color while the indicator is on, else to the second.
+ * @remark  This table is stored in PROGMEM for memory efficiency.
+ * @see     Panel.h for the IndicatorBinding structure.
+ ********************************************************************************************************************/
+constexpr IndicatorBinding cautionIndicators[] PROGMEM = {
+    {FA_18C_hornet_CLIP_APU_ACC_LT,    LED_APU_ACC, NVIS_YELLOW, NVIS_BLACK},
+    {FA_18C_hornet_CLIP_BATT_SW_LT,    LED_BATT_SW, NVIS_YELLOW, NVIS_BLACK},
+    {FA_18C_hornet_CLIP_CK_SEAT_LT,    LED_CK_SEAT, NVIS_YELLOW, NVIS_BLACK},
+    {FA_18C_hornet_CLIP_FCES_LT,       LED_FCES,    NVIS_YELLOW, NVIS_BLACK},
+    {FA_18C_hornet_CLIP_FCS_HOT_LT,    LED_FCS_HOT, NVIS_YELLOW, NVIS_BLACK},
+    {FA_18C_hornet_CLIP_FUEL_LO_LT,    LED_FUEL_LO, NVIS_YELLOW, NVIS_BLACK},
+    {FA_18C_hornet_CLIP_GEN_TIE_LT,    LED_GEN_TIE, NVIS_YELLOW, NVIS_BLACK},
+    {FA_18C_hornet_CLIP_L_GEN_LT,      LED_L_GEN,   NVIS_YELLOW, NVIS_BLACK},
+    {FA_18C_hornet_CLIP_R_GEN_LT,      LED_R_GEN,   NVIS_YELLOW, NVIS_BLACK},
+    {FA_18C_hornet_CLIP_SPARE_CTN1_LT, LED_CSPARE1, NVIS_YELLOW, NVIS_BLACK},
+    {FA_18C_hornet_CLIP_SPARE_CTN2_LT, LED_CSPARE2, NVIS_YELLOW, NVIS_BLACK},
+    {FA_18C_hornet_CLIP_SPARE_CTN3_LT, LED_CSPARE3, NVIS_YELLOW, NVIS_BLACK}
+};
+
 /********************************************************************************************************************
  * @brief   Caution Panel class
  * @details Backlighting controller for the Caution panel.
@@ -77,9 +99,10 @@ public:
      * @return Pointer to the singleton instance
      * @see This method is called by the main .ino file's addPanel() method to create the panel instance
      */
-    static CautionPanel* getInstance(int startIndex = 0, CRGB* ledStrip = nullptr) {
+    static CautionPanel* getInstance(int startIndex = 0, uint8_t* ledStrip = nullptr) {
         if (!instance) {
-            instance = new CautionPanel(startIndex, ledStrip);
+            static CautionPanel panel(startIndex, ledStrip);
+            instance = &panel;                                        // Static storage, no heap allocation
         }
         return instance;
     }
@@ -91,73 +114,15 @@ private:
      * @param ledStrip Pointer to the LED strip array
      * @see This method is called by the public getInstance() if and only if no instance exists yet
      */
-    CautionPanel(int startIndex, CRGB* ledStrip) {
+    CautionPanel(int startIndex, uint8_t* ledStrip) {
         panelStartIndex = startIndex;
         this->ledStrip = ledStrip;
         ledCount = CAUTION_LED_COUNT;
-        ledTable = cautionLedTable;
-    }
-
-    // Static callback functions for DCS-BIOS
-    static void onClipApuAccLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_APU_ACC, newValue ? NVIS_YELLOW : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer clipApuAccLtBuffer{FA_18C_hornet_CLIP_APU_ACC_LT, onClipApuAccLtChange};
-
-    static void onClipBattSwLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_BATT_SW, newValue ? NVIS_YELLOW : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer clipBattSwLtBuffer{FA_18C_hornet_CLIP_BATT_SW_LT, onClipBattSwLtChange};
-
-    static void onClipCkSeatLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_CK_SEAT, newValue ? NVIS_YELLOW : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer clipCkSeatLtBuffer{FA_18C_hornet_CLIP_CK_SEAT_LT, onClipCkSeatLtChange};
-
-    static void onClipFcesLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_FCES, newValue ? NVIS_YELLOW : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer clipFcesLtBuffer{FA_18C_hornet_CLIP_FCES_LT, onClipFcesLtChange};
-
-    static void onClipFcsHotLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_FCS_HOT, newValue ? NVIS_YELLOW : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer clipFcsHotLtBuffer{FA_18C_hornet_CLIP_FCS_HOT_LT, onClipFcsHotLtChange};
-
-    static void onClipFuelLoLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_FUEL_LO, newValue ? NVIS_YELLOW : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer clipFuelLoLtBuffer{FA_18C_hornet_CLIP_FUEL_LO_LT, onClipFuelLoLtChange};
-
-    static void onClipGenTieLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_GEN_TIE, newValue ? NVIS_YELLOW : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer clipGenTieLtBuffer{FA_18C_hornet_CLIP_GEN_TIE_LT, onClipGenTieLtChange};
-
-    static void onClipLGenLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_L_GEN, newValue ? NVIS_YELLOW : NVIS_BLACK);
+        setLedRuns(cautionLedRuns);
     }
-    DcsBios::IntegerBuffer clipLGenLtBuffer{FA_18C_hornet_CLIP_L_GEN_LT, onClipLGenLtChange};
 
-    static void onClipRGenLtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_R_GEN, newValue ? NVIS_YELLOW : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer clipRGenLtBuffer{FA_18C_hornet_CLIP_R_GEN_LT, onClipRGenLtChange};
-
-    static void onClipSpareCtn1LtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_CSPARE1, newValue ? NVIS_YELLOW : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer clipSpareCtn1LtBuffer{FA_18C_hornet_CLIP_SPARE_CTN1_LT, onClipSpareCtn1LtChange};
-
-    static void onClipSpareCtn2LtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_CSPARE2, newValue ? NVIS_YELLOW : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer clipSpareCtn2LtBuffer{FA_18C_hornet_CLIP_SPARE_CTN2_LT, onClipSpareCtn2LtChange};
-
-    static void onClipSpareCtn3LtChange(unsigned int newValue) {
-        if (instance) instance->setIndicatorColor(LED_CSPARE3, newValue ? NVIS_YELLOW : NVIS_BLACK);
-    }
-    DcsBios::IntegerBuffer clipSpareCtn3LtBuffer{FA_18C_hornet_CLIP_SPARE_CTN3_LT, onClipSpareCtn3LtChange};
+    // DCS-BIOS indicator outputs, served by one listener (see cautionIndicators above)
+    IndicatorBindings indicators{this, cautionIndicators};
 
     // Instance data
     static CautionPanel* instance;
@@ -453,6 +453,100 @@ DcsBios::IntegerBuffer instrIntLtBuffer(FA_18C_hornet_INSTR_INT_LT, onInstrIntLt
 
 int MAX487_TX = 2;  //AVOID MAX487 INTERACTION WHILE WORKING IN USB
 
+// STEPPER HOMING CONFIGURATION
+#define HOMING_CLEAR_STEPS 1000  // STEPS MOVED BEFORE SEARCHING THE ZERO SENSOR
+#define HOMING_SEARCH_STEPS 2000 // MAXIMUM STEPS SEARCHING THE ZERO SENSOR
+#define HOMING_SETTLE_MS 500     // PAUSE AT THE ZERO SENSOR BEFORE MOVING TO THE ZERO POINT
+
+/**
+ * @brief Phases of the homing of one stepper gauge, see homeSteppers()
+ */
+enum HomingPhase : uint8_t {
+  HOMING_CLEAR,   // MOVING HOMING_CLEAR_STEPS
+  HOMING_SEARCH,  // STEPPING UNTIL THE ZERO SENSOR IS FOUND
+  HOMING_SETTLE,  // PAUSING AT THE ZERO SENSOR
+  HOMING_OFFSET,  // MOVING THE OFFSET FROM THE ZERO SENSOR TO THE ZERO POINT
+  HOMING_DONE
+};
+
+/**
+ * @brief Homing state of one stepper gauge, see homeSteppers()
+ */
+struct GaugeHoming {
+  Stepper* stepper;
+  uint8_t zeroSensePin;
+  int offsetToZeroPoint;
+  HomingPhase phase;
+  int count;                 // STEPS DONE IN THE CURRENT PHASE
+  unsigned long settleStart; // MILLIS() WHEN THE ZERO SENSOR WAS FOUND
+};
+
+/**
+ * @brief Homes the airspeed, altimeter and VVI steppers at the same time
+ * @details Each gauge moves HOMING_CLEAR_STEPS, then steps until its zero sensor is found (at most
+ *          HOMING_SEARCH_STEPS), pauses HOMING_SETTLE_MS and moves on by its offset to the zero point.
+ *          Each pass steps every gauge that is not done by one step, and Stepper::step() paces each motor
+ *          on its own, so all gauges move together: startup takes as long as the slowest gauge, not the
+ *          sum of all three.
+ * @see This function is called by setup()
+ */
+void homeSteppers() {
+  GaugeHoming gauges[] = {
+    {&stepperSTANDBY_AIR, AIR_ZERO_SENSE_PIN, AIR_OFFSET_TO_ZERO_POINT, HOMING_CLEAR, 0, 0},
+    {&stepperSTANDBY_ALT, ALT_ZERO_SENSE_PIN, ALT_OFFSET_TO_ZERO_POINT, HOMING_CLEAR, 0, 0},
+    {&stepperSTANDBY_VVI, VVI_ZERO_SENSE_PIN, VVI_OFFSET_TO_ZERO_POINT, HOMING_CLEAR, 0, 0}
+  };
+  const uint8_t GAUGE_COUNT = sizeof(gauges) / sizeof(gauges[0]);
+
+  for (uint8_t g = 0; g < GAUGE_COUNT; g++) {
+    pinMode(gauges[g].zeroSensePin, INPUT_PULLUP);
+    gauges[g].stepper->setSpeed(60);
+  }
+
+  uint8_t homing = GAUGE_COUNT;
+  while (homing > 0) {
+    for (uint8_t g = 0; g < GAUGE_COUNT; g++) {
+      GaugeHoming& h = gauges[g];
+      switch (h.phase) {
+        case HOMING_CLEAR:
+          h.stepper->step(1);
+          if (++h.count >= HOMING_CLEAR_STEPS) {
+            h.phase = HOMING_SEARCH;
+            h.count = 0;
+          }
+          break;
+        case HOMING_SEARCH:
+          h.stepper->step(1);
+          if (digitalRead(h.zeroSensePin) == 0) {
+            h.settleStart = millis();
+            h.phase = HOMING_SETTLE;
+          } else if (++h.count > HOMING_SEARCH_STEPS) { // NO ZERO SENSOR FOUND: STAY WHERE WE ARE
+            h.phase = HOMING_DONE;
+            homing--;
+          }
+          break;
+        case HOMING_SETTLE:
+          if (millis() - h.settleStart >= HOMING_SETTLE_MS) {
+            h.phase = HOMING_OFFSET;
+            h.count = 0;
+          }
+          break;
+        case HOMING_OFFSET:
+          if (h.count < h.offsetToZeroPoint) {
+            h.stepper->step(1);
+            h.count++;
+          } else {
+            h.phase = HOMING_DONE;
+            homing--;
+          }
+          break;
+        default:
+          break;
+      }
+    }
+  }
+}
+
 /**
  * @brief Initializes the standby instrument module with OLED displays, stepper motors, and DCS-BIOS communication
  * @see This function is called automatically by Arduino framework at startup
@@ -493,55 +587,16 @@ void setup() {
   updateALT("0", "0");
   updateBARO("2992");
 
-  //AIRSPEED STEPPER HOMING
-  pinMode(AIR_ZERO_SENSE_PIN, INPUT_PULLUP);
-  stepperSTANDBY_AIR.setSpeed(60);
-  stepperSTANDBY_AIR.step(1000);
-  for (int i = 0; i <= 2000; i++) {
-    delay(1);
-    stepperSTANDBY_AIR.step(1);
-    if (digitalRead(AIR_ZERO_SENSE_PIN) == 0) {
-      delay(500);
-      stepperSTANDBY_AIR.step(AIR_OFFSET_TO_ZERO_POINT);
-      break;
-    }
-  }
+  //STEPPER HOMING, ALL GAUGES AT THE SAME TIME
+  homeSteppers();
 
-  posAIR - 0;
+  posAIR = 0;
   AIR = map(0, 0, 65535, 0, 720);
 
-  //ALTIMETER STEPPER HOMING
-  pinMode(ALT_ZERO_SENSE_PIN, INPUT_PULLUP);
-  stepperSTANDBY_ALT.setSpeed(60);
-  stepperSTANDBY_ALT.step(1000);
-  for (int i = 0; i <= 2000; i++) {
-    delay(1);
-    stepperSTANDBY_ALT.step(1);
-    if (digitalRead(ALT_ZERO_SENSE_PIN) == 0) {
-      delay(500);
-      stepperSTANDBY_ALT.step(ALT_OFFSET_TO_ZERO_POINT);
-      break;
-    }
-  }
-
   posALT = 0;
   ALT = 0;
 
-  //VVI STEPPER HOMING
-  pinMode(VVI_ZERO_SENSE_PIN, INPUT_PULLUP);
-  stepperSTANDBY_VVI.setSpeed(60);
-  stepperSTANDBY_VVI.step(1000);
-  for (int i = 0; i <= 2000; i++) {
-    delay(1);
-    stepperSTANDBY_VVI.step(1);
-    if (digitalRead(VVI_ZERO_SENSE_PIN) == 0) {
-      delay(500);
-      stepperSTANDBY_VVI.step(VVI_OFFSET_TO_ZERO_POINT);
-      break;
-    }
-  }
-
-  posVVI - 0;
+  posVVI = 0;
   VVI = map(0, 0, 65535, 0, 720);
 
   FastLED.addLeds<WS2812B, BACKLIGHT_PIN, RGB>(ws2812, BACKLIGHT_COUNT);  // GRB ordering is typical
@@ -0,0 +1,128 @@
+/**
+* HornetStepper Benchmark Sketch
+* Measures the step timing jitter of a HornetStepper gauge while loop() is kept busy for 0, 2, 5 and 20 ms per pass,
+* like a sketch with long DCS-BIOS updates, OLED transfers or LED shows.
+* Build it once as is (steps generated by run() in loop()) and once with HORNET_STEPPER_TIMER defined below (steps
+* generated by the Timer1 interrupt), flash to a bare Uno, Pro Mini or Mega (a gauge on the coil pins is optional),
+* and open the serial monitor at 115200 baud.
+* The needle sweeps between two positions at a constant speed; a high acceleration keeps the ramps to a few steps,
+* which are left out. Each step is timed where it is made: in timer mode by the HORNET_STEPPER_ON_STEP hook of the
+* timer tick, in loop mode right after run() returns with a new position. The jitter is the deviation of the interval
+* between two steps from the ideal interval of 1 s / SPEED. Timestamps come from micros() (4 us resolution).
+*/
+
+//#define HORNET_STEPPER_TIMER                                        // Uncomment to step from the timer interrupt
+#define DCSBIOS_DEFAULT_SERIAL                                        // No IRQ serial: Serial is used for the report
+#define DCSBIOS_DISABLE_SERVO
+
+void recordStep(long pos, unsigned long now);
+#define HORNET_STEPPER_ON_STEP(gauge, position) recordStep(position, micros())
+
+#include "DcsBios.h"
+#include "../Hornet_Stepper.h"
+
+const int SPEED = 300;                                                // Steps per second (HornetStepper default)
+const int ACCEL = 30000;                                              // Steps per second^2, ramps of ~2 steps
+const long LOW_POS = 20;                                              // Sweep end points
+const long HIGH_POS = 700;
+const long RAMP_STEPS = 10;                                           // Steps at each end left out of the statistics
+const unsigned long IDEAL_US = 1000000UL / SPEED;
+const unsigned int LOADS_MS[] = {0, 2, 5, 20};                        // Foreground load per loop() pass
+const unsigned long PERIOD_MS = 10000;                                // Measuring time per load
+
+HornetStepper gauge(4, 5, 6, 7, LOW_POS, HIGH_POS, 1, 65535, SPEED, ACCEL);
+
+long lastPos = LOW_POS;                                               // Position at the last step seen (loop mode)
+volatile unsigned long lastStepUs;                                    // Time of the last step
+volatile unsigned long steps;                                         // Intervals recorded
+volatile unsigned long sumJitter;                                     // Sum of |interval - IDEAL_US|
+volatile unsigned long maxJitter;
+volatile unsigned long histogram[4];                                  // Jitter < 100 us, < 500 us, < 2 ms, >= 2 ms
+
+/**
+ * @brief Records the interval since the previous step
+ * @param pos The position the needle stepped to
+ * @param now micros() at the step
+ * @note  In timer mode, this is called from the Timer1 tick (other interrupts enabled, further ticks masked), so
+ *        loop() reads the statistics with interrupts disabled. In loop mode, it is called from loop() only.
+ */
+void recordStep(long pos, unsigned long now) {
+    unsigned long interval = now - lastStepUs;
+    lastStepUs = now;
+    if (pos < LOW_POS + RAMP_STEPS || pos > HIGH_POS - RAMP_STEPS) return;
+
+    unsigned long jitter = (interval > IDEAL_US) ? interval - IDEAL_US : IDEAL_US - interval;
+    steps++;
+    sumJitter += jitter;
+    if (jitter > maxJitter) maxJitter = jitter;
+    histogram[(jitter < 100) ? 0 : (jitter < 500) ? 1 : (jitter < 2000) ? 2 : 3]++;
+}
+
+void resetStats() {
+    noInterrupts();
+    steps = 0;
+    sumJitter = 0;
+    maxJitter = 0;
+    for (uint8_t i = 0; i < 4; i++) histogram[i] = 0;
+    interrupts();
+}
+
+void report(unsigned int loadMs) {
+    noInterrupts();
+    unsigned long n = steps;
+    unsigned long sum = sumJitter;
+    unsigned long max = maxJitter;
+    unsigned long h[4] = {histogram[0], histogram[1], histogram[2], histogram[3]};
+    interrupts();
+
+    Serial.print(F("load "));
+    Serial.print(loadMs);
+    Serial.print(F(" ms: "));
+    Serial.print(n);
+    Serial.print(F(" steps, jitter avg "));
+    Serial.print(n ? sum / n : 0);
+    Serial.print(F(" us, max "));
+    Serial.print(max);
+    Serial.print(F(" us, <100us "));
+    Serial.print(h[0]);
+    Serial.print(F(", <500us "));
+    Serial.print(h[1]);
+    Serial.print(F(", <2ms "));
+    Serial.print(h[2]);
+    Serial.print(F(", >=2ms "));
+    Serial.println(h[3]);
+}
+
+void setup() {
+    Serial.begin(115200);
+#ifdef HORNET_STEPPER_TIMER
+    Serial.println(F("HornetStepper Benchmark Ready (timer interrupt)"));
+#else
+    Serial.println(F("HornetStepper Benchmark Ready (loop)"));
+#endif
+    HornetStepper::begin();
+    gauge.setTarget(65535);
+}
+
+void loop() {
+    static uint8_t load = 0;
+    static unsigned long periodStart = millis();
+
+    gauge.run();
+    long pos = gauge.getCurrentPosition();
+#ifndef HORNET_STEPPER_TIMER
+    if (pos != lastPos) recordStep(pos, micros());                    // run() makes at most one step per call
+    lastPos = pos;
+#endif
+    if (pos == HIGH_POS) gauge.setTarget(0);
+    else if (pos == LOW_POS) gauge.setTarget(65535);
+
+    for (unsigned int ms = 0; ms < LOADS_MS[load]; ms++) delayMicroseconds(1000);
+
+    if (millis() - periodStart >= PERIOD_MS) {
+        report(LOADS_MS[load]);
+        load = (load + 1) % (sizeof(LOADS_MS) / sizeof(LOADS_MS[0]));
+        resetStats();
+        periodStart = millis();
+    }
+}
@@ -33,8 +33,8 @@
 /**
  @file      HornetStepper.h
  @author    Ulukaii
- @date      13.01.2026
- @version   0.3.0
+ @date      17.10.2026
+ @version   0.4.0
  @copyright Copyright 2016-2026 OpenHornet. Licensed under the Apache License, Version 2.0.
  @brief     Common class to control stepper-run gauges in OpenHornet. 
  @details   Uses the AccelStepper library to control the stepper motor.
@@ -63,6 +63,15 @@
             testFullRange() functions to zero and test the range of the gauge:
             myStepper.findZero();
             myStepper.testFullRange();
+            These block until the gauge is done. Alternatively, start them without blocking
+            with myStepper.startHoming(true); run() then advances them, and isHoming() tells
+            when the gauge is done.
+            With several gauges, home them all at the same time instead of one after the other:
+            HornetStepper::homeAll(true);
+            (or HornetStepper::startHomingAll(true) without blocking, see there).
+            Up to HORNET_STEPPER_MAX_GAUGES (8) gauges are homed this way; with more gauges, #define it
+            higher before including this file, otherwise homeAll() and begin() halt the sketch and blink
+            the built-in LED rapidly.
 
             (4/4) 
             In your main .ino, in the loop(), call the run() function like this:
@@ -71,7 +80,32 @@
             Optional functionalities:
             - Adapt speed and acceleration by changing normalSpeed and normalAccel
             - Enable non.linear mapping with the optional mapPoints parameter  
+            - For gauges updated at the full export rate, precompute the non-linear mapping at compile
+              time instead: a lookup table in PROGMEM with linear interpolation between its entries,
+              constant time and without heap use:
+              constexpr MapPoint MY_POINTS[] = {{0, 20}, {32768, 500}, {65535, 700}};
+              HORNET_STEPPER_MAP_TABLE(MY_TABLE, MY_POINTS);
+              HornetStepper myStepper(COIL1, COIL2, COIL3, COIL4, ZERO_POS, MAX_POS,
+                                     DIRECTION, CAP_VALUE, normalSpeed, normalAccel, MY_TABLE);
+              The table has 2^HORNET_STEPPER_MAP_BITS segments: 256 by default (514 bytes of flash),
+              or 512 with #define HORNET_STEPPER_MAP_BITS 9 before including this file (1026 bytes).
+              MapPoints closer together than one segment (256 or 128 DCS-BIOS units) are smoothed over
+              it; keep the mapPoints parameter for gauges where such a sharp bend matters.
             - Press CLR and ENT buttons on UFC at the same time to manually trigger homing.
+              The gauge re-homes and tests its range within run(), without blocking the sketch.
+            - Step all gauges from a timer interrupt instead of from loop(), so that the needles keep
+              moving smoothly while loop() is busy (long DCS-BIOS updates, OLED transfers, LED shows):
+              #define HORNET_STEPPER_TIMER before including this file, and call HornetStepper::begin()
+              in setup() (otherwise, the first run(), startHoming() or findZero() starts it). Timer1
+              then generates the steps of all gauges every HORNET_STEPPER_TICK_US, and run() only
+              handles the homing trigger. Timer1 is no longer available for the Servo
+              library (define DCSBIOS_DISABLE_SERVO) or analogWrite() on its pins.
+              In this mode, the steps are not scheduled by AccelStepper (floating point math and a
+              square root per step), but by a group scheduler with integer math only: all gauges
+              share one ramp table (HORNET_STEPPER_RAMP), generated at compile time and scaled per
+              gauge from normalSpeed and normalAccel.
+              See HornetStepperBenchmark/HornetStepperBenchmark.ino for the step timing jitter; it
+              defines HORNET_STEPPER_ON_STEP(gauge, position) to time each step as the timer makes it.
 
 */
 
@@ -84,6 +118,33 @@
 #include "DcsBios.h"
 #include <MultiMap.h>                                                 // by Rob Tillart
 
+#ifdef HORNET_STEPPER_TIMER
+#ifndef TIMER1_COMPA_vect
+#error "HORNET_STEPPER_TIMER needs the 16-bit Timer1 of the AVR boards (Uno, Pro Mini, Leonardo, Mega)"
+#endif
+#endif
+
+#ifndef HORNET_STEPPER_TICK_US
+#define HORNET_STEPPER_TICK_US 250                                    // Timer tick: steps of all gauges are generated on this grid
+#endif
+
+#ifndef HORNET_STEPPER_MAX_GAUGES
+#define HORNET_STEPPER_MAX_GAUGES 8                                   // Gauges registered for homeAll() and the timer;
+                                                                      // more gauges halt begin() and startHomingAll()
+#endif
+
+#ifndef HORNET_STEPPER_ON_STEP
+#define HORNET_STEPPER_ON_STEP(gauge, position)                       // Called after each step of the timer (benchmarks)
+#endif
+
+#define HORNET_STEPPER_RAMP_STEPS 256                                 // Entries of the acceleration ramp table
+
+#ifndef HORNET_STEPPER_MAP_BITS
+#define HORNET_STEPPER_MAP_BITS 8                                     // Map tables of 2^8 = 256 segments (or 9: 512)
+#endif
+#define HORNET_STEPPER_MAP_SHIFT (16 - HORNET_STEPPER_MAP_BITS)       // Input bits within one segment
+#define HORNET_STEPPER_MAP_ENTRIES ((1 << HORNET_STEPPER_MAP_BITS) + 1)
+
 /**
  * @brief Only in case of non-linear gauges, this struct is used. 
  *        It represents a value-position mapping pair. 
@@ -93,6 +154,106 @@ struct MapPoint {
     unsigned int position;                                            // Stepper step position (e.g. 0-720)
     };
 
+/**
+ * @brief Map table for non-linear gauges, generated at compile time by HORNET_STEPPER_MAP_TABLE()
+ */
+struct HornetMapTable {
+    const uint16_t* entries;                                          // HORNET_STEPPER_MAP_ENTRIES positions in PROGMEM
+};
+
+/**
+ * @brief   Position of a DCS-BIOS value on segment i of a MapPoint array (from point i-1 to point i), or a later one
+ */
+constexpr long hornetMapSegment(const MapPoint* points, uint8_t count, long value, uint8_t i) {
+    return (i < count - 1 && value > (long)points[i].value)
+        ? hornetMapSegment(points, count, value, i + 1)
+        : (long)(points[i - 1].position + 0.5
+                 + (double)(value - (long)points[i - 1].value) * ((long)points[i].position - (long)points[i - 1].position)
+                   / ((long)points[i].value - (long)points[i - 1].value));
+}
+
+/**
+ * @brief   Position of a DCS-BIOS value by linear interpolation between MapPoints, like multiMap, at compile time
+ *          (rounded to the nearest step)
+ */
+constexpr uint16_t hornetMapAt(const MapPoint* points, uint8_t count, long value) {
+    return (value <= (long)points[0].value) ? points[0].position
+         : (value >= (long)points[count - 1].value) ? points[count - 1].position
+         : hornetMapSegment(points, count, value, 1);
+}
+
+/**
+ * @brief   Checks at compile time that the values of a MapPoint array are strictly ascending
+ */
+constexpr bool hornetMapAscending(const MapPoint* points, uint8_t count, uint8_t i = 1) {
+    return (i >= count) || (points[i].value > points[i - 1].value && hornetMapAscending(points, count, i + 1));
+}
+
+/**
+ * @brief   Entry i of a map table: the position of the DCS-BIOS value at the start of segment i
+ */
+constexpr uint16_t hornetMapEntry(const MapPoint* points, uint8_t count, long i) {
+    return hornetMapAt(points, count, ((i << HORNET_STEPPER_MAP_SHIFT) > 65535) ? 65535 : (i << HORNET_STEPPER_MAP_SHIFT));
+}
+
+#define HORNET_MAP_1(p, i)   hornetMapEntry(p, sizeof(p) / sizeof(p[0]), i)
+#define HORNET_MAP_4(p, i)   HORNET_MAP_1(p, i), HORNET_MAP_1(p, i + 1), HORNET_MAP_1(p, i + 2), HORNET_MAP_1(p, i + 3)
+#define HORNET_MAP_16(p, i)  HORNET_MAP_4(p, i), HORNET_MAP_4(p, i + 4), HORNET_MAP_4(p, i + 8), HORNET_MAP_4(p, i + 12)
+#define HORNET_MAP_64(p, i)  HORNET_MAP_16(p, i), HORNET_MAP_16(p, i + 16), HORNET_MAP_16(p, i + 32), HORNET_MAP_16(p, i + 48)
+#define HORNET_MAP_256(p, i) HORNET_MAP_64(p, i), HORNET_MAP_64(p, i + 64), HORNET_MAP_64(p, i + 128), HORNET_MAP_64(p, i + 192)
+
+#if HORNET_STEPPER_MAP_BITS == 8
+#define HORNET_MAP_ALL(p) HORNET_MAP_256(p, 0), HORNET_MAP_1(p, 256)
+#elif HORNET_STEPPER_MAP_BITS == 9
+#define HORNET_MAP_ALL(p) HORNET_MAP_256(p, 0), HORNET_MAP_256(p, 256), HORNET_MAP_1(p, 512)
+#else
+#error "HORNET_STEPPER_MAP_BITS must be 8 (256 segments) or 9 (512 segments)"
+#endif
+
+/**
+ * @brief   Defines the map table `name` from a constexpr MapPoint array `points`, computed at compile time
+ * @details Entry i holds the position of the DCS-BIOS value i * 2^HORNET_STEPPER_MAP_SHIFT (the last one that of
+ *          65535), interpolated between the MapPoints like multiMap does.
+ */
+#define HORNET_STEPPER_MAP_TABLE(name, points)                                                              \
+    static_assert(hornetMapAscending(points, sizeof(points) / sizeof(points[0])),                           \
+                  "MapPoint values of " #points " must be ascending");                                      \
+    constexpr uint16_t name##_ENTRIES[HORNET_STEPPER_MAP_ENTRIES] PROGMEM = {HORNET_MAP_ALL(points)};      \
+    const HornetMapTable name = {name##_ENTRIES}
+
+/**
+ * @brief   Square root by Newton's method, for the ramp table at compile time
+ */
+constexpr double hornetRampSqrt(double x, double guess = 1.0, uint8_t i = 0) {
+    return (i == 24) ? guess : hornetRampSqrt(x, 0.5 * (guess + x / guess), i + 1);
+}
+
+/**
+ * @brief   Entry n of the acceleration ramp: sqrt(n+1) - sqrt(n), in 0.16 fixed point
+ * @details Accelerating from rest at a constant rate a, step n+1 follows step n after c0 * (sqrt(n+1) - sqrt(n)),
+ *          where c0 = sqrt(2 / a) is the time to the first step (D. Austin, "Generate stepper-motor speed profiles
+ *          in real time"). The difference is computed as 1 / (sqrt(n+1) + sqrt(n)) to keep its precision.
+ */
+constexpr uint16_t hornetRampEntry(uint16_t n) {
+    return (n == 0) ? 0xffff : (uint16_t)(65536.0 / (hornetRampSqrt(n + 1) + hornetRampSqrt(n)) + 0.5);
+}
+
+#define HORNET_RAMP_4(n)  hornetRampEntry(n), hornetRampEntry(n + 1), hornetRampEntry(n + 2), hornetRampEntry(n + 3)
+#define HORNET_RAMP_16(n) HORNET_RAMP_4(n), HORNET_RAMP_4(n + 4), HORNET_RAMP_4(n + 8), HORNET_RAMP_4(n + 12)
+#define HORNET_RAMP_64(n) HORNET_RAMP_16(n), HORNET_RAMP_16(n + 16), HORNET_RAMP_16(n + 32), HORNET_RAMP_16(n + 48)
+
+/**
+ * @brief Acceleration ramp shared by all gauges in timer mode. Each gauge scales it with its own c0, decelerating
+ *        walks it backwards.
+ */
+constexpr uint16_t HORNET_STEPPER_RAMP[HORNET_STEPPER_RAMP_STEPS] PROGMEM = {
+    HORNET_RAMP_64(0), HORNET_RAMP_64(64), HORNET_RAMP_64(128), HORNET_RAMP_64(192)
+};
+
+#undef HORNET_RAMP_4
+#undef HORNET_RAMP_16
+#undef HORNET_RAMP_64
+
 /**
  * @brief   Common class to control stepper-run gauges in OpenHornet. 
  * @details Uses the AccelStepper library to control the stepper motor.
@@ -112,10 +273,275 @@ private:
     unsigned int* inputVals;                                          // Extracted input values array for multiMapBS
     unsigned int* outputPos;                                          // Extracted output positions array for multiMapBS
     bool useMultiMap;                                                 // Flag to use multiMap vs linear mapping
+    const uint16_t* mapTable;                                         // Map table in PROGMEM (optional, else nullptr)
+
+    /**
+     * @brief AccelStepper with access to its coil output, for the steps generated by tick()
+     */
+    class CoilStepper : public AccelStepper {
+    public:
+        using AccelStepper::AccelStepper;
+        void output(long position) { step(position); }                // Energizes the coils for this position
+    };
+
+    CoilStepper stepper;                                              // Stepper motor object
+    bool      timerStepped;                                           // Stepped by tick() instead of run()
+
+    /**
+     * @brief Phases of homing and range test, advanced by run()
+     */
+    enum HomingPhase : uint8_t {
+        HOMING_IDLE,                                                  // Normal operation
+        HOMING_TO_STOP,                                               // Moving back to the mechanical stop
+        HOMING_TO_ZERO,                                               // Moving forward to the dial zero
+        TEST_TO_MAX,                                                  // Range test: moving to the maximum position
+        TEST_PAUSE,                                                   // Range test: holding at the maximum position
+        TEST_TO_ZERO                                                  // Range test: moving back to the dial zero
+    };
+    static const int HOMING_SPEED = 20;                               // Slow speed for zeroing operation
+    static const int HOMING_ACCEL = 10;
+    static const unsigned long TEST_PAUSE_MS = 2000;                  // Hold time at the maximum position
+
+    HomingPhase phase;                                                // Current phase of homing and range test
+    bool      testAfterHoming;                                        // Run the range test when homing is done
+    int       testSpeed;                                              // Speed and acceleration of the range test
+    int       testAccel;
+    unsigned long pauseStart;                                         // millis() at the start of TEST_PAUSE
+    long      lastTarget;                                             // Last target set, resumed after homing
+    bool      homeTriggerHeld;                                        // CLR+ENT seen pressed at the last run()
+
+    /**
+     * @brief Motion state of the group scheduler (timer mode), in place of the one of AccelStepper
+     */
+    struct Motion {
+        long     position;                                            // Current position, in steps from mech 0
+        long     target;                                              // Target position
+        int8_t   dir;                                                 // Direction of the move (1 or -1), 0 at rest
+        uint16_t rampIndex;                                           // Steps taken on the ramp, 0 at rest
+        uint16_t rampLength;                                          // Ramp steps from rest to cruise speed
+        uint16_t c0;                                                  // Interval before the first step, in ticks
+        uint32_t cruise;                                              // Interval at cruise speed, in 1/256 ticks
+        int32_t  countdown;                                           // Time to the next step, in 1/256 ticks
+    } motion;
+
+    static HornetStepper* gauges[HORNET_STEPPER_MAX_GAUGES];          // Gauges homed by homeAll(), stepped by tick()
+    static uint8_t numGauges;                                         // Number of entries in gauges
+    static bool gaugesOverflow;                                       // More gauges than HORNET_STEPPER_MAX_GAUGES
+    static bool timerStarted;                                         // begin() has started the timer tick
+    static void (*onGaugeHomed)(HornetStepper& gauge);                // Reports each gauge done homing
+
+    /**
+     * @brief   Keeps the timer tick away from the stepper and its motion state while it exists
+     * @details Neither is interrupt-safe: every access from loop() to them must hold this lock
+     *          in timer mode. Only the Timer1 compare interrupt is masked, serial reception and millis() keep
+     *          running. Without HORNET_STEPPER_TIMER, the lock does nothing.
+     */
+    struct TickLock {
+#ifdef HORNET_STEPPER_TIMER
+        uint8_t saved;                                                // TIMSK1 before locking
+        TickLock() : saved(TIMSK1) {
+            TIMSK1 = saved & ~_BV(OCIE1A);
+            asm volatile("" ::: "memory");                            // Reread the motion state after locking
+        }
+        ~TickLock() {
+            asm volatile("" ::: "memory");                            // Write the motion state before unlocking
+            TIMSK1 = saved;
+        }
+#else
+        TickLock() {}
+        ~TickLock() {}
+#endif
+    };
+
+    /**
+     * @brief Sets the maximum speed and the acceleration of the stepper
+     */
+    void setMotion(int speed, int accel) {
+        TickLock lock;
+        stepper.setMaxSpeed(speed);
+        stepper.setAcceleration(accel);
+        setRamp(speed, accel);
+    }
+
+    /**
+     * @brief   Scales the shared ramp table to a speed and an acceleration, for the group scheduler
+     * @details Floating point math is used here only, when the motion parameters change, not per step.
+     *          Ramps longer than the table continue at the same acceleration, see rampInterval(). Ramps are
+     *          limited to 65535 steps, far beyond the range of any gauge; the acceleration is never changed.
+     */
+    void setRamp(int speed, int accel) {
+        const float ticksPerSecond = 1000000.0 / HORNET_STEPPER_TICK_US;
+        float rampSteps = (float)speed * speed / (2.0 * accel);       // Steps from rest to cruise speed
+        if (rampSteps > 65535) rampSteps = 65535;
+        motion.rampLength = max(1L, (long)(rampSteps + 0.5));
+        motion.c0 = ticksPerSecond * sqrt(2.0 / accel) + 0.5;
+        motion.cruise = 256.0 * ticksPerSecond / speed + 0.5;
+        if (motion.rampIndex > motion.rampLength) motion.rampIndex = motion.rampLength;
+    }
+
+    /**
+     * @brief   Gets the interval before the next step at a ramp index, in 1/256 ticks
+     * @details Past the table, sqrt(n+1) - sqrt(n) is close to 1 / (2 * sqrt(n)), which halves when n is
+     *          multiplied by 4: entry n is taken as entry n / 4 shifted right by one, until n / 4^k is in the table
+     *          (error below 0.5% from n = 256 on).
+     */
+    uint32_t rampInterval(uint16_t index) const {
+        if (index >= motion.rampLength) return motion.cruise;
+        uint8_t shift = 8;
+        while (index >= HORNET_STEPPER_RAMP_STEPS) {
+            index >>= 2;
+            shift++;
+        }
+        uint32_t interval = ((uint32_t)motion.c0 * pgm_read_word(&HORNET_STEPPER_RAMP[index])) >> shift;
+        return (interval < motion.cruise) ? motion.cruise : interval;
+    }
+
+    /**
+     * @brief   Advances the motion of the group scheduler by one timer tick, stepping when a step is due
+     * @details Accelerates along the ramp table while the remaining distance allows stopping within the steps
+     *          taken so far, cruises at the end of the ramp, and walks the ramp back down to stop at the target.
+     *          A target behind the needle is reached by stopping first and then starting over.
+     * @see     This method is called by tick()
+     */
+    void tickMotion() {
+        if (motion.dir == 0 && motion.position == motion.target) return;    // At rest
+        motion.countdown -= 256;
+        if (motion.countdown > 0) return;
+
+        if (motion.dir != 0) {
+            motion.position += motion.dir;
+            stepper.output(motion.position);
+            HORNET_STEPPER_ON_STEP(*this, motion.position);
+            long remaining = (motion.target - motion.position) * motion.dir;
+            if (remaining <= motion.rampIndex) {                      // Brake: stop at (or turn back to) the target
+                if (motion.rampIndex > 0) motion.rampIndex--;
+                if (motion.rampIndex == 0 && remaining <= 0) motion.dir = 0;
+            } else if (motion.rampIndex < motion.rampLength) {        // Accelerate
+                motion.rampIndex++;
+            }
+        }
+        if (motion.dir == 0) {
+            if (motion.position == motion.target) {
+                motion.countdown = 0;
+                return;
+            }
+            motion.dir = (motion.target > motion.position) ? 1 : -1;  // Start from rest
+            motion.rampIndex = 0;
+        }
+        motion.countdown += rampInterval(motion.rampIndex);
+    }
+
+    /**
+     * @brief Checks if the stepper is still moving (or has a target to move to)
+     */
+    bool isMoving() {
+        TickLock lock;
+        if (timerStepped) return motion.dir != 0 || motion.position != motion.target;
+        return stepper.isRunning();
+    }
+
+    /**
+     * @brief Redefines the current position of the stepper, e.g. at the mechanical stop
+     */
+    void setPosition(long position) {
+        TickLock lock;
+        stepper.setCurrentPosition(position);
+        motion.position = position;
+        motion.target = position;
+        motion.dir = 0;
+        motion.rampIndex = 0;
+        motion.countdown = 0;
+    }
+
+    /**
+     * @brief Sets the target position of the stepper
+     */
+    void moveTo(long position) {
+        TickLock lock;
+        if (timerStepped) motion.target = position;
+        else stepper.moveTo(position);
+    }
+
+    /**
+     * @brief Starts the range test from the dial zero
+     */
+    void beginRangeTest() {
+        setMotion(testSpeed, testAccel);
+        moveTo(maxPos);
+        phase = TEST_TO_MAX;
+    }
+
+    /**
+     * @brief Ends homing or range test and resumes normal operation at the last target
+     */
+    void endHoming() {
+        setMotion(normalSpeed, normalAccel);                          // Resume normal speed and acceleration
+        moveTo(lastTarget);
+        phase = HOMING_IDLE;
+        if (onGaugeHomed != nullptr) {
+            onGaugeHomed(*this);
+            if (!isHomingAll()) onGaugeHomed = nullptr;               // Only for this homeAll(), not a later CLR+ENT
+        }
+    }
+
+    /**
+     * @brief Halts the sketch if a gauge could not be registered, since homeAll() and the timer would miss it
+     * @note  The needles then stay where they are at startup, and the built-in LED blinks rapidly (5 Hz) to show
+     *        why. Raise HORNET_STEPPER_MAX_GAUGES before including this file to register more gauges.
+     */
+    static void checkRegistered() {
+        if (!gaugesOverflow) return;
+        pinMode(LED_BUILTIN, OUTPUT);
+        while (true) {
+            digitalWrite(LED_BUILTIN, HIGH);
+            delay(100);
+            digitalWrite(LED_BUILTIN, LOW);
+            delay(100);
+        }
+    }
+
+    /**
+     * @brief Starts the timer tick if the sketch has not called begin(), so that timer-stepped gauges always move
+     * @see   This method is called by startHoming(), startRangeTest() and run()
+     */
+    static void ensureStarted() {
+#ifdef HORNET_STEPPER_TIMER
+        if (!timerStarted) begin();
+#endif
+    }
 
-    AccelStepper stepper;                                             // Stepper motor object
-    bool      homingInProgress;                                       // Track if homing is in progress
-    bool      testInProgress;                                         // Track if test is in progress
+    /**
+     * @brief   Advances homing and range test to the next phase once the current one is done
+     * @see     This method is called by run()
+     */
+    void advanceHoming() {
+        if (phase == HOMING_IDLE || isMoving()) return;
+        switch (phase) {
+            case HOMING_TO_STOP:
+                setPosition(mechZero);                                // At mech stop, set coordinate sys to 0
+                moveTo(zeroPos);                                      // Move forward to position that is 0 on dial
+                phase = HOMING_TO_ZERO;
+                break;
+            case HOMING_TO_ZERO:
+                if (testAfterHoming) beginRangeTest();
+                else endHoming();
+                break;
+            case TEST_TO_MAX:
+                pauseStart = millis();
+                phase = TEST_PAUSE;
+                break;
+            case TEST_PAUSE:
+                if (millis() - pauseStart < TEST_PAUSE_MS) break;
+                moveTo(zeroPos);
+                phase = TEST_TO_ZERO;
+                break;
+            case TEST_TO_ZERO:
+                endHoming();
+                break;
+            default:
+                break;
+        }
+    }
 
 public:
                                                                       // Track button states to manually trigger homing
@@ -160,11 +586,29 @@ public:
         this->capValue = capValue;
         this->normalSpeed = normalSpeed;
         this->normalAccel = normalAccel;
-        this->homingInProgress = false;
-        this->testInProgress = false;
+        this->timerStepped = false;
+        this->phase = HOMING_IDLE;
+        this->testAfterHoming = false;
+        this->testSpeed = HOMING_SPEED;
+        this->testAccel = HOMING_ACCEL;
+        this->pauseStart = 0;
+        this->lastTarget = zeroPos;
+        this->homeTriggerHeld = false;
+        this->mapTable = nullptr;
         
         stepper.setMaxSpeed(normalSpeed);
         stepper.setAcceleration(normalAccel);
+        setPosition(0);
+        setRamp(normalSpeed, normalAccel);
+
+        if (numGauges < HORNET_STEPPER_MAX_GAUGES) {
+            gauges[numGauges++] = this;
+#ifdef HORNET_STEPPER_TIMER
+            timerStepped = true;
+#endif
+        } else {
+            gaugesOverflow = true;                                    // Hard error at begin() or startHomingAll()
+        }
 
         // Handle mapping array - if nullptr passed, use linear mapping
         if (mapPoints != nullptr && numMapPoints > 0) {
@@ -190,6 +634,23 @@ public:
         }
     }
 
+    /**
+     * @brief Constructor for HornetStepper with a map table for non-linear mapping
+     * @param mapTable Map table defined with HORNET_STEPPER_MAP_TABLE()
+     * @note  All other parameters as above. The table replaces the mapPoints: setTarget() then looks the
+     *        position up in constant time, and no arrays are allocated.
+     */
+    HornetStepper(int coil1, int coil2, int coil3, int coil4,
+                  int zeroPos, int maxPos, int dirForward,
+                  unsigned int capValue,
+                  int normalSpeed,
+                  int normalAccel,
+                  const HornetMapTable& mapTable)
+        : HornetStepper(coil1, coil2, coil3, coil4, zeroPos, maxPos, dirForward, capValue, normalSpeed, normalAccel)
+    {
+        this->mapTable = mapTable.entries;
+    }
+
     /**
      * @brief Destructor to clean up allocated arrays
      */
@@ -198,50 +659,161 @@ public:
             delete[] inputVals;
             delete[] outputPos;
         }
+        TickLock lock;
+        for (uint8_t i = 0; i < numGauges; i++) {
+            if (gauges[i] == this) {
+                gauges[i] = gauges[--numGauges];
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief   Starts the timer that steps all gauges (timer mode only)
+     * @details Timer1 runs in CTC mode with prescaler 8 and fires the compare A interrupt every
+     *          HORNET_STEPPER_TICK_US. Without HORNET_STEPPER_TIMER, this does nothing.
+     * @note    Call this once in setup(), before findZero(), testFullRange() or startHoming(). If the sketch does not,
+     *          the first of these or of run() calls it.
+     *          Halts if more than HORNET_STEPPER_MAX_GAUGES gauges exist, see checkRegistered().
+     */
+    static void begin() {
+        checkRegistered();
+#ifdef HORNET_STEPPER_TIMER
+        timerStarted = true;
+        noInterrupts();
+        TCCR1A = 0;
+        TCCR1B = _BV(WGM12) | _BV(CS11);                              // CTC mode, prescaler 8
+        TCNT1 = 0;
+        OCR1A = (F_CPU / 8 / 1000000UL) * HORNET_STEPPER_TICK_US - 1;
+        TIFR1 = _BV(OCF1A);
+        TIMSK1 |= _BV(OCIE1A);
+        interrupts();
+#endif
+    }
+
+    /**
+     * @brief Generates the due steps of all registered gauges
+     * @see   This method is called by the Timer1 compare A interrupt in timer mode
+     */
+    static void tick() {
+        for (uint8_t i = 0; i < numGauges; i++) {
+            if (gauges[i]->timerStepped) gauges[i]->tickMotion();
+        }
+    }
+
+    /**
+     * @brief   Starts homing all gauges at the same time, without blocking
+     * @param   withRangeTest Also test the range of each gauge when zeroed
+     * @param   onHomed Optional function called with each gauge when it is done (from its run())
+     * @details All gauges move toward their mechanical stop at once, so the time until all are ready is
+     *          the time of the slowest gauge, not the sum of all. Call run() of every gauge (or runAll())
+     *          in loop(); isHomingAll() tells when all are done. onHomed is cleared when the last gauge is done, so
+     *          a later re-home by CLR+ENT does not call it again.
+     *          Halts if more than HORNET_STEPPER_MAX_GAUGES gauges exist, see checkRegistered().
+     */
+    static void startHomingAll(bool withRangeTest = false, void (*onHomed)(HornetStepper& gauge) = nullptr) {
+        checkRegistered();
+        onGaugeHomed = onHomed;
+        for (uint8_t i = 0; i < numGauges; i++) {
+            gauges[i]->startHoming(withRangeTest);
+        }
+    }
+
+    /**
+     * @brief isHomingAll() tells if any gauge is still homing or testing its range
+     */
+    static bool isHomingAll() {
+        for (uint8_t i = 0; i < numGauges; i++) {
+            if (gauges[i]->isHoming()) return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief runAll() calls run() of all gauges
+     */
+    static void runAll() {
+        for (uint8_t i = 0; i < numGauges; i++) {
+            gauges[i]->run();
+        }
+    }
+
+    /**
+     * @brief homeAll() homes all gauges at the same time (blocking)
+     * @note  Same as startHomingAll(), but returns only when all gauges are done.
+     */
+    static void homeAll(bool withRangeTest = false, void (*onHomed)(HornetStepper& gauge) = nullptr) {
+        startHomingAll(withRangeTest, onHomed);
+        while (isHomingAll()) runAll();
+    }
+
+    /**
+     * @brief Gets the current position of the needle, in steps from the low mechanical stop
+     */
+    long getCurrentPosition() {
+        TickLock lock;
+        return timerStepped ? motion.position : stepper.currentPosition();
     }
 
     
     /**
-     * @brief   findZero() is a function to zero the gauge
-     * @note    The gauge is zeroed by slowly moving the needle to mechanical zero), then to 
-     *          the dial zero position. You may hear clocking sounds. This is normal. 
+     * @brief   startHoming() starts zeroing the gauge, without blocking
+     * @param   withRangeTest Also test the range of the gauge when zeroed (see testFullRange())
+     * @note    The gauge is zeroed by slowly moving the needle to mechanical zero, then to
+     *          the dial zero position. You may hear clocking sounds. This is normal.
+     *          run() advances the homing; the gauge is done when isHoming() returns false.
+     *          Targets set in the meantime are resumed afterwards.
      * @details Coordinate system:
      *          - Position 0 = mechanical zero (physical stop)
      *          - Position zeroPos (e.g., 20) = dial zero (where gauge shows "0")
      */
+    void startHoming(bool withRangeTest = false) {
+        ensureStarted();                                              // Else findZero() would wait for a tick forever
+        testAfterHoming = withRangeTest;
+        testSpeed = HOMING_SPEED;
+        testAccel = HOMING_ACCEL;
+        setMotion(HOMING_SPEED, HOMING_ACCEL);
+        setPosition(maxPos);                                          // Assume needle at max position
+        moveTo(mechZero);                                             // Move backwards to mech stop
+        phase = HOMING_TO_STOP;
+    }
+
+    /**
+     * @brief startRangeTest() starts testing the range of the gauge, without blocking
+     * @note  During the test, the gauge is moved all the way up, held there for 2 seconds and moved
+     *        back to the dial zero. run() advances the test; the gauge is done when isHoming() returns false.
+     */
+    void startRangeTest(int testSpeed = HOMING_SPEED, int testAccel = HOMING_ACCEL) {
+        ensureStarted();
+        this->testSpeed = testSpeed;
+        this->testAccel = testAccel;
+        beginRangeTest();
+    }
+
+    /**
+     * @brief isHoming() tells if homing or range test of the gauge are still in progress
+     */
+    bool isHoming() const {
+        return phase != HOMING_IDLE;
+    }
+
+    /**
+     * @brief   findZero() is a function to zero the gauge (blocking)
+     * @note    Same as startHoming(), but returns only when the gauge is zeroed.
+     */
     void findZero() {
-        int zeroingSpeed = 20;                                         // Slow speed for zeroing operation
-        int zeroingAccel = 10;
-        stepper.setMaxSpeed(zeroingSpeed);
-        stepper.setAcceleration(zeroingAccel);
-
-        stepper.setCurrentPosition(maxPos);                           // Assume needle at max position
-        stepper.runToNewPosition(mechZero);                           // Move backwards to mech stop
-        stepper.setCurrentPosition(mechZero);                         // At mech stop, set coordinate sys to 0
-        stepper.runToNewPosition(zeroPos);                            // Move forward to position that is 0 on dial
-        
-        stepper.setMaxSpeed(normalSpeed);                             // Resume normal speed and acceleration
-        stepper.setAcceleration(normalAccel);
+        startHoming();
+        while (isHoming()) run();
     }
     
 
     /**
-     * @brief testFullRange() is a function to test the range of the gauge
-     * @note  During the test, the gauge is moved all the way. 
-     *        runToNewPosition() blocks the CPU during test.
+     * @brief testFullRange() is a function to test the range of the gauge (blocking)
+     * @note  Same as startRangeTest(), but returns only when the test is done.
      */
-    void testFullRange(int testSpeed = 20, int testAccel = 10) {
-        testInProgress = true;
-        stepper.setMaxSpeed(testSpeed);
-        stepper.setAcceleration(testAccel);
-
-        stepper.runToNewPosition(maxPos);
-        delay(2000);
-        stepper.runToNewPosition(zeroPos);
-        
-        stepper.setMaxSpeed(normalSpeed);
-        stepper.setAcceleration(normalAccel);
-        testInProgress = false;
+    void testFullRange(int testSpeed = HOMING_SPEED, int testAccel = HOMING_ACCEL) {
+        startRangeTest(testSpeed, testAccel);
+        while (isHoming()) run();
     }
     
 
@@ -251,8 +823,11 @@ public:
      * @details Maps DCS BIOS value to stepper position:
      *          1) cap targetVal at capValue as needed
      *          2) map capped value to stepper position, 
-     *             using multiMapBS if useMultiMap is true, otherwise use standard linear mapping
-     *          3) call the moveTo() function of AccelStepper to pass the new target position.
+     *             using the map table if there is one, multiMapBS if useMultiMap is true,
+     *             otherwise use standard linear mapping
+     *          3) call moveTo() to pass the new target position to AccelStepper
+     *             (in timer mode, the target is only posted to the group scheduler; the timer generates the steps)
+     *          During homing and range test, the target is kept and resumed afterwards.
      */
     void setTarget(unsigned int targetVal) {
         // 1) Cap targetVal at capValue as needed
@@ -260,33 +835,43 @@ public:
         
         // 2) map capped value to stepper position
         long targetPos;
-        if (useMultiMap) {
+        if (mapTable != nullptr) {
+            // Look up the segment in the map table and interpolate within it
+            uint16_t index = trimmedVal >> HORNET_STEPPER_MAP_SHIFT;
+            long low = pgm_read_word(&mapTable[index]);
+            long high = pgm_read_word(&mapTable[index + 1]);
+            long within = trimmedVal & ((1U << HORNET_STEPPER_MAP_SHIFT) - 1);
+            targetPos = low + (((high - low) * within + (1L << (HORNET_STEPPER_MAP_SHIFT - 1))) >> HORNET_STEPPER_MAP_SHIFT);
+        } else if (useMultiMap) {
             // Use multiMap with pre-extracted arrays
             targetPos = multiMapCache<unsigned int>(trimmedVal, inputVals, outputPos, numMapPoints);
         } else {
             targetPos = map(trimmedVal, 0, capValue, zeroPos, maxPos);
         }
         
-        // 3) call the moveTo() function of AccelStepper to pass the new target position.
-        stepper.moveTo(targetPos);
+        // 3) call moveTo() to pass the new target position.
+        lastTarget = targetPos;
+        if (phase == HOMING_IDLE) moveTo(targetPos);
     }
     
 
     /**
      * @brief run() is a function to run the stepper motor (non-blocking)
      * @note This method must be called repeatedly in the main loop to perform movement.
-     *       It also checks for button-triggered homing and startup test.
+     *       It also checks for button-triggered homing and startup test, and advances them.
+     *       In timer mode, the steps are generated by the timer and this only handles homing.
      */
     void run() {
+        ensureStarted();
         bool shouldHome = ufcEntPressed && ufcClrPressed;
         
-        if (shouldHome && !homingInProgress && !testInProgress) {
-            homingInProgress = true;
-            findZero();
-            testFullRange();
-            homingInProgress = false;
+        if (shouldHome && !homeTriggerHeld && phase == HOMING_IDLE) {
+            startHoming(true);                                        // Re-home and test once per press
         }
+        homeTriggerHeld = shouldHome;
+        advanceHoming();
         
+        if (timerStepped) return;
         stepper.run();
     }
     
@@ -295,6 +880,21 @@ public:
 // Static member definitions
 bool HornetStepper::ufcEntPressed = false;
 bool HornetStepper::ufcClrPressed = false;
+HornetStepper* HornetStepper::gauges[HORNET_STEPPER_MAX_GAUGES];
+uint8_t HornetStepper::numGauges = 0;
+bool HornetStepper::gaugesOverflow = false;
+bool HornetStepper::timerStarted = false;
+void (*HornetStepper::onGaugeHomed)(HornetStepper& gauge) = nullptr;
+
+#ifdef HORNET_STEPPER_TIMER
+ISR(TIMER1_COMPA_vect) {                                              // Steps all gauges every HORNET_STEPPER_TICK_US
+    TIMSK1 &= ~_BV(OCIE1A);                                           // No nested ticks if a tick overruns
+    sei();                                                            // Serial reception and millis() stay served
+    HornetStepper::tick();
+    cli();
+    TIMSK1 |= _BV(OCIE1A);
+}
+#endif
 
 // DCS-BIOS callbacks for homing trigger buttons
 void onUfcEntChange(unsigned int newVal) {